@@ -138,7 +138,7 @@ void ssd1306_TestCircle()
 void ssd1306_TestArc()
 {
   ssd1306_SetColor(White);
-  ssd1306_DrawArc(30, 30, 30, 20, 270);
+  ssd1306_DrawArc(30, 30, 30, 20, 250);
   ssd1306_UpdateScreen();
   return;
 }
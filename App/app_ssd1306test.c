@@ -173,7 +173,7 @@ void mainApp(void)
     ssd1306_UpdateScreen();
     HAL_Delay(2000);
     ssd1306_Clear();
-    ssd1306_DrawBitmap(0, 0, 128, 64, stm32fan);
+    ssd1306_DrawCompressedBitmap(0, 0, stm32fan_packed, BLIT_TRANSPARENT);
     ssd1306_UpdateScreen();
     HAL_Delay(2000);
     ssd1306_InvertDisplay();
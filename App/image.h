@@ -1,72 +1,29 @@
 #ifndef IMAGE_H_
 #define IMAGE_H_
 
-// 'logo', 128x64px
-const unsigned char stm32fan [] = {
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xfc,
-  0x3c, 0x3c, 0x3c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
-  0x3c, 0x7c, 0x7c, 0x7c, 0x7c, 0xfc, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x3c, 0x3c, 0x1c, 0x0c, 0x0c,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xe0, 0xe0, 0xe0,
-  0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0,
-  0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0xfe, 0xfc, 0xf8, 0xf8, 0xf8, 0xf0, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0x80, 0x00, 0x00, 0xc0, 0xc0,
-  0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x83, 0x83, 0x83, 0xc7, 0xe7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf8, 0xf0,
-  0xe0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f,
-  0x8f, 0x0f, 0x0f, 0x0f, 0x2f, 0x2f, 0x4f, 0x4f, 0x4f, 0x5f, 0xff, 0xef, 0xcf, 0xcf, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0xef, 0xcf, 0xef, 0xff, 0xff, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0x0c, 0x3c, 0x7c,
-  0x1c, 0x0c, 0x8c, 0x0c, 0x0e, 0x0e, 0x0e, 0xfe, 0xff, 0xdf, 0xcf, 0xcf, 0xef, 0x6f, 0x6f, 0x2f,
-  0x0f, 0x1f, 0xff, 0xff, 0xff, 0xdf, 0xcf, 0xef, 0xef, 0x6f, 0x6f, 0x0f, 0x0f, 0x9f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c,
-  0x0c, 0x08, 0x08, 0x09, 0x09, 0x49, 0x48, 0x48, 0x4c, 0x4c, 0x4f, 0x4f, 0xcf, 0xff, 0xfc, 0xf8,
-  0xf8, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x18, 0x08, 0x08, 0x0c, 0x8e, 0x8c, 0x08, 0x08,
-  0x08, 0x3e, 0x7f, 0xf8, 0xf8, 0xf8, 0xfc, 0xff, 0xff, 0xfc, 0xfc, 0xf9, 0xfb, 0xfb, 0x0b, 0x0b,
-  0x0c, 0x0c, 0x0e, 0x0f, 0x0f, 0x19, 0x38, 0xfa, 0xfa, 0x0a, 0x0b, 0x0b, 0x0b, 0x0b, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x03, 0x03, 0x07, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xef, 0xe7, 0xe3, 0xe0, 0xe0, 0xe0, 0xf0, 0xf8, 0xf8, 0xf9, 0xf9, 0xf8, 0xf8,
-  0xe0, 0xe0, 0xe0, 0xe1, 0xe3, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0,
-  0xe0, 0xe0, 0xe0, 0xff, 0xfe, 0xfc, 0xf0, 0xf0, 0xe1, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff,
-  0xff, 0x7f, 0x7f, 0x7f, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x0f, 0x07, 0x03, 0x03, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x38, 0x3f, 0x3f, 0x3f, 0x3f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
-  0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-  0x07, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// 'stm32fan_packed', 128x64px, 1024 -> 323 bytes (ssd1306_DrawCompressedBitmap)
+const unsigned char stm32fan_packed [] = {
+  0x80, 0x40, 0xd8, 0xff, 0xff, 0x41, 0x80, 0x42, 0xc0, 0x42, 0xe0, 0x43, 0xf0, 0x44, 0xf8, 0x00,
+  0xfc, 0x41, 0x3c, 0x43, 0x1c, 0x47, 0x3c, 0x42, 0x7c, 0x00, 0xfc, 0x43, 0x7c, 0x80, 0x19, 0x02,
+  0x0c, 0x0c, 0x04, 0x88, 0x41, 0x42, 0xe0, 0x41, 0xc0, 0x41, 0x80, 0xe5, 0x02, 0x80, 0xc0, 0xe0,
+  0x81, 0x67, 0x40, 0xfc, 0x40, 0xfe, 0x58, 0xff, 0x02, 0xfe, 0xfe, 0xfc, 0x41, 0xf8, 0x02, 0xf0,
+  0x30, 0x10, 0x8e, 0x3c, 0x80, 0x65, 0x80, 0x6c, 0x85, 0x6d, 0x00, 0x81, 0x41, 0x83, 0x01, 0xc7,
+  0xe7, 0x89, 0x37, 0x40, 0xfc, 0x80, 0x37, 0x80, 0x91, 0x93, 0x8d, 0x00, 0xf8, 0x92, 0x73, 0x01,
+  0x9f, 0x8f, 0x41, 0x0f, 0x40, 0x2f, 0x41, 0x4f, 0x02, 0x5f, 0xff, 0xef, 0x40, 0xcf, 0x43, 0x0f,
+  0x05, 0xef, 0xcf, 0xef, 0xff, 0xff, 0x0f, 0x42, 0x0e, 0x06, 0x0c, 0x3c, 0x7c, 0x1c, 0x0c, 0x8c,
+  0x0c, 0x41, 0x0e, 0x0a, 0xfe, 0xff, 0xdf, 0xcf, 0xcf, 0xef, 0x6f, 0x6f, 0x2f, 0x0f, 0x1f, 0x40,
+  0xff, 0x80, 0x0b, 0x00, 0xef, 0x80, 0x0b, 0x02, 0x0f, 0x0f, 0x9f, 0x95, 0xc3, 0x00, 0xf0, 0xd1,
+  0x04, 0x03, 0x0f, 0x1f, 0x3f, 0x7f, 0x4f, 0xff, 0x0e, 0x0c, 0x0c, 0x08, 0x08, 0x09, 0x09, 0x49,
+  0x48, 0x48, 0x4c, 0x4c, 0x4f, 0x4f, 0xcf, 0xff, 0x81, 0xfa, 0x00, 0xfc, 0x42, 0xff, 0x06, 0x7f,
+  0x18, 0x08, 0x08, 0x0c, 0x8e, 0x8c, 0x41, 0x08, 0x01, 0x3e, 0x7f, 0x83, 0x13, 0x10, 0xfc, 0xfc,
+  0xf9, 0xfb, 0xfb, 0x0b, 0x0b, 0x0c, 0x0c, 0x0e, 0x0f, 0x0f, 0x19, 0x38, 0xfa, 0xfa, 0x0a, 0x42,
+  0x0b, 0x52, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x0f, 0x01, 0xd7, 0x04, 0x01, 0x01, 0x03, 0x03, 0x07,
+  0x40, 0x0f, 0x47, 0xff, 0x44, 0xe0, 0x46, 0xfe, 0x44, 0xff, 0x02, 0xef, 0xe7, 0xe3, 0x41, 0xe0,
+  0x00, 0xf0, 0x40, 0xf8, 0x40, 0xf9, 0x40, 0xf8, 0x41, 0xe0, 0x02, 0xe1, 0xe3, 0xef, 0x8a, 0x2e,
+  0x05, 0xff, 0xfe, 0xfc, 0xf0, 0xf0, 0xe1, 0x43, 0xe0, 0x41, 0xff, 0x41, 0x7f, 0x41, 0x3f, 0x40,
+  0x1f, 0x41, 0x0f, 0x00, 0x07, 0x40, 0x03, 0x40, 0x01, 0xe2, 0x00, 0x38, 0x42, 0x3f, 0x43, 0x1f,
+  0x45, 0x0f, 0x43, 0x07, 0x80, 0x3d, 0x49, 0x07, 0x4e, 0x0f, 0x48, 0x07, 0x44, 0x03, 0x44, 0x01,
+  0xe1, 0xff, 0xff
 };
 
 #endif /* IMAGE_H_ */
@@ -1,7 +1,109 @@
 
 #include "fonts.h"
+#include "ssd1306_defines.h"
+#include <stddef.h>
 
-// Dit zijn de bitmaps voor de 3 verschillende fonts
+#if SSD1306_FONT_PAGES != 1
+// Dit zijn de bitmaps voor de 4 verschillende fonts
+
+// 5x7 glyphs in a 6x8 cell (the empty bottom row and right column separate the lines and chars)
+static const uint16_t Font6x8 [] = {
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // sp
+0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000,  // !
+0x5000, 0x5000, 0x5000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // "
+0x5000, 0x5000, 0xF800, 0x5000, 0xF800, 0x5000, 0x5000, 0x0000,  // #
+0x2000, 0x7800, 0xA000, 0x7000, 0x2800, 0xF000, 0x2000, 0x0000,  // $
+0xC000, 0xC800, 0x1000, 0x2000, 0x4000, 0x9800, 0x1800, 0x0000,  // %
+0x6000, 0x9000, 0xA000, 0x4000, 0xA800, 0x9000, 0x6800, 0x0000,  // &
+0x6000, 0x2000, 0x4000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // '
+0x1000, 0x2000, 0x4000, 0x4000, 0x4000, 0x2000, 0x1000, 0x0000,  // (
+0x4000, 0x2000, 0x1000, 0x1000, 0x1000, 0x2000, 0x4000, 0x0000,  // )
+0x0000, 0x2000, 0xA800, 0x7000, 0xA800, 0x2000, 0x0000, 0x0000,  // *
+0x0000, 0x2000, 0x2000, 0xF800, 0x2000, 0x2000, 0x0000, 0x0000,  // +
+0x0000, 0x0000, 0x0000, 0x0000, 0x6000, 0x2000, 0x4000, 0x0000,  // ,
+0x0000, 0x0000, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000,  // -
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6000, 0x6000, 0x0000,  // .
+0x0000, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000, 0x0000, 0x0000,  // /
+0x7000, 0x8800, 0x9800, 0xA800, 0xC800, 0x8800, 0x7000, 0x0000,  // 0
+0x2000, 0x6000, 0x2000, 0x2000, 0x2000, 0x2000, 0x7000, 0x0000,  // 1
+0x7000, 0x8800, 0x0800, 0x1000, 0x2000, 0x4000, 0xF800, 0x0000,  // 2
+0xF800, 0x1000, 0x2000, 0x1000, 0x0800, 0x8800, 0x7000, 0x0000,  // 3
+0x1000, 0x3000, 0x5000, 0x9000, 0xF800, 0x1000, 0x1000, 0x0000,  // 4
+0xF800, 0x8000, 0xF000, 0x0800, 0x0800, 0x8800, 0x7000, 0x0000,  // 5
+0x3000, 0x4000, 0x8000, 0xF000, 0x8800, 0x8800, 0x7000, 0x0000,  // 6
+0xF800, 0x0800, 0x1000, 0x2000, 0x4000, 0x4000, 0x4000, 0x0000,  // 7
+0x7000, 0x8800, 0x8800, 0x7000, 0x8800, 0x8800, 0x7000, 0x0000,  // 8
+0x7000, 0x8800, 0x8800, 0x7800, 0x0800, 0x1000, 0x6000, 0x0000,  // 9
+0x0000, 0x6000, 0x6000, 0x0000, 0x6000, 0x6000, 0x0000, 0x0000,  // :
+0x0000, 0x6000, 0x6000, 0x0000, 0x6000, 0x2000, 0x4000, 0x0000,  // ;
+0x1000, 0x2000, 0x4000, 0x8000, 0x4000, 0x2000, 0x1000, 0x0000,  // <
+0x0000, 0x0000, 0xF800, 0x0000, 0xF800, 0x0000, 0x0000, 0x0000,  // =
+0x4000, 0x2000, 0x1000, 0x0800, 0x1000, 0x2000, 0x4000, 0x0000,  // >
+0x7000, 0x8800, 0x0800, 0x1000, 0x2000, 0x0000, 0x2000, 0x0000,  // ?
+0x7000, 0x8800, 0x0800, 0x6800, 0xA800, 0xA800, 0x7000, 0x0000,  // @
+0x7000, 0x8800, 0x8800, 0x8800, 0xF800, 0x8800, 0x8800, 0x0000,  // A
+0xF000, 0x8800, 0x8800, 0xF000, 0x8800, 0x8800, 0xF000, 0x0000,  // B
+0x7000, 0x8800, 0x8000, 0x8000, 0x8000, 0x8800, 0x7000, 0x0000,  // C
+0xE000, 0x9000, 0x8800, 0x8800, 0x8800, 0x9000, 0xE000, 0x0000,  // D
+0xF800, 0x8000, 0x8000, 0xF000, 0x8000, 0x8000, 0xF800, 0x0000,  // E
+0xF800, 0x8000, 0x8000, 0xF000, 0x8000, 0x8000, 0x8000, 0x0000,  // F
+0x7000, 0x8800, 0x8000, 0xB800, 0x8800, 0x8800, 0x7800, 0x0000,  // G
+0x8800, 0x8800, 0x8800, 0xF800, 0x8800, 0x8800, 0x8800, 0x0000,  // H
+0x7000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x7000, 0x0000,  // I
+0x3800, 0x1000, 0x1000, 0x1000, 0x1000, 0x9000, 0x6000, 0x0000,  // J
+0x8800, 0x9000, 0xA000, 0xC000, 0xA000, 0x9000, 0x8800, 0x0000,  // K
+0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0xF800, 0x0000,  // L
+0x8800, 0xD800, 0xA800, 0xA800, 0x8800, 0x8800, 0x8800, 0x0000,  // M
+0x8800, 0x8800, 0xC800, 0xA800, 0x9800, 0x8800, 0x8800, 0x0000,  // N
+0x7000, 0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x7000, 0x0000,  // O
+0xF000, 0x8800, 0x8800, 0xF000, 0x8000, 0x8000, 0x8000, 0x0000,  // P
+0x7000, 0x8800, 0x8800, 0x8800, 0xA800, 0x9000, 0x6800, 0x0000,  // Q
+0xF000, 0x8800, 0x8800, 0xF000, 0xA000, 0x9000, 0x8800, 0x0000,  // R
+0x7800, 0x8000, 0x8000, 0x7000, 0x0800, 0x0800, 0xF000, 0x0000,  // S
+0xF800, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000,  // T
+0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x7000, 0x0000,  // U
+0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x5000, 0x2000, 0x0000,  // V
+0x8800, 0x8800, 0x8800, 0xA800, 0xA800, 0xA800, 0x5000, 0x0000,  // W
+0x8800, 0x8800, 0x5000, 0x2000, 0x5000, 0x8800, 0x8800, 0x0000,  // X
+0x8800, 0x8800, 0x8800, 0x5000, 0x2000, 0x2000, 0x2000, 0x0000,  // Y
+0xF800, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000, 0xF800, 0x0000,  // Z
+0x7000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x7000, 0x0000,  // [
+0x0000, 0x8000, 0x4000, 0x2000, 0x1000, 0x0800, 0x0000, 0x0000,  // backslash
+0x7000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x7000, 0x0000,  // ]
+0x2000, 0x5000, 0x8800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // ^
+0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0x0000,  // _
+0x4000, 0x2000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // `
+0x0000, 0x0000, 0x7000, 0x0800, 0x7800, 0x8800, 0x7800, 0x0000,  // a
+0x8000, 0x8000, 0xB000, 0xC800, 0x8800, 0x8800, 0xF000, 0x0000,  // b
+0x0000, 0x0000, 0x7000, 0x8000, 0x8000, 0x8800, 0x7000, 0x0000,  // c
+0x0800, 0x0800, 0x6800, 0x9800, 0x8800, 0x8800, 0x7800, 0x0000,  // d
+0x0000, 0x0000, 0x7000, 0x8800, 0xF800, 0x8000, 0x7000, 0x0000,  // e
+0x3000, 0x4800, 0x4000, 0xE000, 0x4000, 0x4000, 0x4000, 0x0000,  // f
+0x0000, 0x7800, 0x8800, 0x8800, 0x7800, 0x0800, 0x7000, 0x0000,  // g
+0x8000, 0x8000, 0xB000, 0xC800, 0x8800, 0x8800, 0x8800, 0x0000,  // h
+0x2000, 0x0000, 0x6000, 0x2000, 0x2000, 0x2000, 0x7000, 0x0000,  // i
+0x1000, 0x0000, 0x3000, 0x1000, 0x1000, 0x9000, 0x6000, 0x0000,  // j
+0x8000, 0x8000, 0x9000, 0xA000, 0xC000, 0xA000, 0x9000, 0x0000,  // k
+0x6000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x7000, 0x0000,  // l
+0x0000, 0x0000, 0xD000, 0xA800, 0xA800, 0x8800, 0x8800, 0x0000,  // m
+0x0000, 0x0000, 0xB000, 0xC800, 0x8800, 0x8800, 0x8800, 0x0000,  // n
+0x0000, 0x0000, 0x7000, 0x8800, 0x8800, 0x8800, 0x7000, 0x0000,  // o
+0x0000, 0x0000, 0xF000, 0x8800, 0xF000, 0x8000, 0x8000, 0x0000,  // p
+0x0000, 0x0000, 0x6800, 0x9800, 0x7800, 0x0800, 0x0800, 0x0000,  // q
+0x0000, 0x0000, 0xB000, 0xC800, 0x8000, 0x8000, 0x8000, 0x0000,  // r
+0x0000, 0x0000, 0x7000, 0x8000, 0x7000, 0x0800, 0xF000, 0x0000,  // s
+0x4000, 0x4000, 0xE000, 0x4000, 0x4000, 0x4800, 0x3000, 0x0000,  // t
+0x0000, 0x0000, 0x8800, 0x8800, 0x8800, 0x9800, 0x6800, 0x0000,  // u
+0x0000, 0x0000, 0x8800, 0x8800, 0x8800, 0x5000, 0x2000, 0x0000,  // v
+0x0000, 0x0000, 0x8800, 0x8800, 0xA800, 0xA800, 0x5000, 0x0000,  // w
+0x0000, 0x0000, 0x8800, 0x5000, 0x2000, 0x5000, 0x8800, 0x0000,  // x
+0x0000, 0x0000, 0x8800, 0x8800, 0x7800, 0x0800, 0x7000, 0x0000,  // y
+0x0000, 0x0000, 0xF800, 0x1000, 0x2000, 0x4000, 0xF800, 0x0000,  // z
+0x1000, 0x2000, 0x2000, 0x4000, 0x2000, 0x2000, 0x1000, 0x0000,  // {
+0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x2000, 0x0000,  // |
+0x4000, 0x2000, 0x2000, 0x1000, 0x2000, 0x2000, 0x4000, 0x0000,  // }
+0x0000, 0x0000, 0x4000, 0xA800, 0x1000, 0x0000, 0x0000, 0x0000,  // ~
+};
 
 static const uint16_t Font7x10 [] = {
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // sp
@@ -296,11 +398,1265 @@ static const uint16_t Font16x26 [] = {
 0x3FC0,0x03E0,0x01E0,0x01E0,0x01E0,0x01E0,0x01C0,0x03C0,0x03C0,0x01C0,0x01E0,0x00FE,0x00FE,0x01E0,0x01C0,0x03C0,0x03C0,0x01C0,0x01E0,0x01E0,0x01E0,0x01E0,0x03E0,0x3FC0,0x3F00,0x0000, // Ascii = [}]
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3F07,0x7FC7,0x73E7,0xF1FF,0xF07E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [~]
 };
+#endif
+
+
+#if SSD1306_FONT_PAGES != 0
+//
+// The same fonts in page-major format (made by Tools/fonts/fontconv.c):
+// for every char and every 8-row page of the glyph one byte per column
+// (bit 0: top row), as the bytes of the screenbuffer
+//
+static const uint8_t Font6x8_Pages [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,  // sp
+0x00,0x00,0x5F,0x00,0x00,0x00,  // !
+0x00,0x07,0x00,0x07,0x00,0x00,  // "
+0x14,0x7F,0x14,0x7F,0x14,0x00,  // #
+0x24,0x2A,0x7F,0x2A,0x12,0x00,  // $
+0x23,0x13,0x08,0x64,0x62,0x00,  // %
+0x36,0x49,0x55,0x22,0x50,0x00,  // &
+0x00,0x05,0x03,0x00,0x00,0x00,  // '
+0x00,0x1C,0x22,0x41,0x00,0x00,  // (
+0x00,0x41,0x22,0x1C,0x00,0x00,  // )
+0x14,0x08,0x3E,0x08,0x14,0x00,  // *
+0x08,0x08,0x3E,0x08,0x08,0x00,  // +
+0x00,0x50,0x30,0x00,0x00,0x00,  // ,
+0x08,0x08,0x08,0x08,0x08,0x00,  // -
+0x00,0x60,0x60,0x00,0x00,0x00,  // .
+0x20,0x10,0x08,0x04,0x02,0x00,  // /
+0x3E,0x51,0x49,0x45,0x3E,0x00,  // 0
+0x00,0x42,0x7F,0x40,0x00,0x00,  // 1
+0x42,0x61,0x51,0x49,0x46,0x00,  // 2
+0x21,0x41,0x45,0x4B,0x31,0x00,  // 3
+0x18,0x14,0x12,0x7F,0x10,0x00,  // 4
+0x27,0x45,0x45,0x45,0x39,0x00,  // 5
+0x3C,0x4A,0x49,0x49,0x30,0x00,  // 6
+0x01,0x71,0x09,0x05,0x03,0x00,  // 7
+0x36,0x49,0x49,0x49,0x36,0x00,  // 8
+0x06,0x49,0x49,0x29,0x1E,0x00,  // 9
+0x00,0x36,0x36,0x00,0x00,0x00,  // :
+0x00,0x56,0x36,0x00,0x00,0x00,  // ;
+0x08,0x14,0x22,0x41,0x00,0x00,  // <
+0x14,0x14,0x14,0x14,0x14,0x00,  // =
+0x00,0x41,0x22,0x14,0x08,0x00,  // >
+0x02,0x01,0x51,0x09,0x06,0x00,  // ?
+0x32,0x49,0x79,0x41,0x3E,0x00,  // @
+0x7E,0x11,0x11,0x11,0x7E,0x00,  // A
+0x7F,0x49,0x49,0x49,0x36,0x00,  // B
+0x3E,0x41,0x41,0x41,0x22,0x00,  // C
+0x7F,0x41,0x41,0x22,0x1C,0x00,  // D
+0x7F,0x49,0x49,0x49,0x41,0x00,  // E
+0x7F,0x09,0x09,0x09,0x01,0x00,  // F
+0x3E,0x41,0x49,0x49,0x7A,0x00,  // G
+0x7F,0x08,0x08,0x08,0x7F,0x00,  // H
+0x00,0x41,0x7F,0x41,0x00,0x00,  // I
+0x20,0x40,0x41,0x3F,0x01,0x00,  // J
+0x7F,0x08,0x14,0x22,0x41,0x00,  // K
+0x7F,0x40,0x40,0x40,0x40,0x00,  // L
+0x7F,0x02,0x0C,0x02,0x7F,0x00,  // M
+0x7F,0x04,0x08,0x10,0x7F,0x00,  // N
+0x3E,0x41,0x41,0x41,0x3E,0x00,  // O
+0x7F,0x09,0x09,0x09,0x06,0x00,  // P
+0x3E,0x41,0x51,0x21,0x5E,0x00,  // Q
+0x7F,0x09,0x19,0x29,0x46,0x00,  // R
+0x46,0x49,0x49,0x49,0x31,0x00,  // S
+0x01,0x01,0x7F,0x01,0x01,0x00,  // T
+0x3F,0x40,0x40,0x40,0x3F,0x00,  // U
+0x1F,0x20,0x40,0x20,0x1F,0x00,  // V
+0x3F,0x40,0x38,0x40,0x3F,0x00,  // W
+0x63,0x14,0x08,0x14,0x63,0x00,  // X
+0x07,0x08,0x70,0x08,0x07,0x00,  // Y
+0x61,0x51,0x49,0x45,0x43,0x00,  // Z
+0x00,0x7F,0x41,0x41,0x00,0x00,  // [
+0x02,0x04,0x08,0x10,0x20,0x00,  // backslash
+0x00,0x41,0x41,0x7F,0x00,0x00,  // ]
+0x04,0x02,0x01,0x02,0x04,0x00,  // ^
+0x40,0x40,0x40,0x40,0x40,0x00,  // _
+0x00,0x01,0x02,0x04,0x00,0x00,  // `
+0x20,0x54,0x54,0x54,0x78,0x00,  // a
+0x7F,0x48,0x44,0x44,0x38,0x00,  // b
+0x38,0x44,0x44,0x44,0x20,0x00,  // c
+0x38,0x44,0x44,0x48,0x7F,0x00,  // d
+0x38,0x54,0x54,0x54,0x18,0x00,  // e
+0x08,0x7E,0x09,0x01,0x02,0x00,  // f
+0x0C,0x52,0x52,0x52,0x3E,0x00,  // g
+0x7F,0x08,0x04,0x04,0x78,0x00,  // h
+0x00,0x44,0x7D,0x40,0x00,0x00,  // i
+0x20,0x40,0x44,0x3D,0x00,0x00,  // j
+0x7F,0x10,0x28,0x44,0x00,0x00,  // k
+0x00,0x41,0x7F,0x40,0x00,0x00,  // l
+0x7C,0x04,0x18,0x04,0x78,0x00,  // m
+0x7C,0x08,0x04,0x04,0x78,0x00,  // n
+0x38,0x44,0x44,0x44,0x38,0x00,  // o
+0x7C,0x14,0x14,0x14,0x08,0x00,  // p
+0x08,0x14,0x14,0x18,0x7C,0x00,  // q
+0x7C,0x08,0x04,0x04,0x08,0x00,  // r
+0x48,0x54,0x54,0x54,0x20,0x00,  // s
+0x04,0x3F,0x44,0x40,0x20,0x00,  // t
+0x3C,0x40,0x40,0x20,0x7C,0x00,  // u
+0x1C,0x20,0x40,0x20,0x1C,0x00,  // v
+0x3C,0x40,0x30,0x40,0x3C,0x00,  // w
+0x44,0x28,0x10,0x28,0x44,0x00,  // x
+0x0C,0x50,0x50,0x50,0x3C,0x00,  // y
+0x44,0x64,0x54,0x4C,0x44,0x00,  // z
+0x00,0x08,0x36,0x41,0x00,0x00,  // {
+0x00,0x00,0x7F,0x00,0x00,0x00,  // |
+0x00,0x41,0x36,0x08,0x00,0x00,  // }
+0x08,0x04,0x08,0x10,0x08,0x00,  // ~
+};
+
+static const uint8_t Font7x10_Pages [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // sp
+0x00,0x00,0x00,0xBF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // !
+0x00,0x00,0x07,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // "
+0x00,0xF4,0x2F,0x24,0xF4,0x2F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // #
+0x00,0x66,0x89,0xFF,0x89,0x72,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,  // $
+0x00,0x26,0x19,0x6E,0x94,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // %
+0x00,0x60,0x96,0x99,0x66,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // &
+0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '
+0x00,0x00,0xFC,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x00,0x00,  // (
+0x00,0x00,0x01,0x02,0xFC,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,  // )
+0x00,0x00,0x0A,0x07,0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // *
+0x00,0x10,0x10,0x7C,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // +
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // ,
+0x00,0x00,0x20,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // -
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // .
+0x00,0x00,0xC0,0x3C,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // /
+0x00,0x7E,0x81,0x89,0x81,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 0
+0x00,0x04,0x02,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 1
+0x00,0x86,0xC1,0xA1,0x91,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 2
+0x00,0x42,0x81,0x89,0x89,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 3
+0x00,0x30,0x2C,0x22,0xFF,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 4
+0x00,0x4F,0x89,0x89,0x89,0x71,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 5
+0x00,0x7E,0x89,0x89,0x89,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 6
+0x00,0x01,0xE1,0x19,0x05,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 7
+0x00,0x76,0x89,0x89,0x89,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 8
+0x00,0x4E,0x91,0x91,0x91,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 9
+0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // :
+0x00,0x00,0x00,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // ;
+0x00,0x10,0x28,0x28,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <
+0x00,0x28,0x28,0x28,0x28,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // =
+0x00,0x44,0x44,0x28,0x28,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // >
+0x00,0x02,0x01,0xB1,0x09,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ?
+0x00,0x7E,0x81,0x99,0x95,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // @
+0x00,0xE0,0x3E,0x21,0x3E,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // A
+0x00,0xFF,0x89,0x89,0x89,0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // B
+0x00,0x7E,0x81,0x81,0x81,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // C
+0x00,0xFF,0x81,0x81,0x42,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // D
+0x00,0xFF,0x89,0x89,0x89,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // E
+0x00,0xFF,0x09,0x09,0x09,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // F
+0x00,0x7E,0x81,0x91,0x91,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // G
+0x00,0xFF,0x08,0x08,0x08,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // H
+0x00,0x00,0x81,0xFF,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // I
+0x00,0x40,0x80,0x80,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // J
+0x00,0xFF,0x08,0x14,0x62,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // K
+0x00,0xFF,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // L
+0x00,0xFF,0x06,0x08,0x06,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // M
+0x00,0xFF,0x06,0x18,0x60,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // N
+0x00,0x7E,0x81,0x81,0x81,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // O
+0x00,0xFF,0x11,0x11,0x11,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // P
+0x00,0x7E,0x81,0xC1,0x81,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,  // Q
+0x00,0xFF,0x11,0x11,0x71,0x8E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // R
+0x00,0x46,0x89,0x89,0x91,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // S
+0x00,0x01,0x01,0xFF,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // T
+0x00,0x7F,0x80,0x80,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // U
+0x00,0x07,0x38,0xC0,0x38,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // V
+0x00,0x3F,0xE0,0x1C,0xE0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // W
+0x00,0x81,0x66,0x18,0x66,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // X
+0x00,0x03,0x0C,0xF0,0x0C,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // Y
+0x00,0xC1,0xA1,0x99,0x85,0x83,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // Z
+0x00,0x00,0x00,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x00,0x00,  // [
+0x00,0x00,0x03,0x3C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // backslash
+0x00,0x00,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x00,0x00,  // ]
+0x00,0x08,0x06,0x01,0x06,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ^
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x02,  // _
+0x00,0x00,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // `
+0x00,0x68,0x94,0x94,0x54,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // a
+0x00,0xFF,0x48,0x84,0x84,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // b
+0x00,0x78,0x84,0x84,0x84,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // c
+0x00,0x78,0x84,0x84,0x48,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // d
+0x00,0x78,0x94,0x94,0x94,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // e
+0x00,0x04,0x04,0xFE,0x05,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // f
+0x00,0x78,0x84,0x84,0x48,0xFC,0x00,0x00,0x02,0x02,0x02,0x02,0x01,0x00,  // g
+0x00,0xFF,0x08,0x04,0x04,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // h
+0x00,0x04,0x04,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // i
+0x00,0x04,0x04,0xFD,0x00,0x00,0x00,0x02,0x02,0x02,0x01,0x00,0x00,0x00,  // j
+0x00,0xFF,0x10,0x28,0x44,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // k
+0x00,0x01,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // l
+0x00,0xFC,0x04,0xFC,0x04,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // m
+0x00,0xFC,0x08,0x04,0x04,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // n
+0x00,0x78,0x84,0x84,0x84,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // o
+0x00,0xFC,0x48,0x84,0x84,0x78,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,  // p
+0x00,0x78,0x84,0x84,0x48,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,  // q
+0x00,0xFC,0x08,0x04,0x04,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // r
+0x00,0x48,0x94,0x94,0xA4,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // s
+0x00,0x04,0x7F,0x84,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // t
+0x00,0x7C,0x80,0x80,0x40,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // u
+0x00,0x0C,0x70,0x80,0x70,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // v
+0x00,0x3C,0xE0,0x1C,0xE0,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // w
+0x00,0x84,0x48,0x30,0x48,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // x
+0x00,0x0C,0x30,0xC0,0x30,0x0C,0x00,0x00,0x02,0x02,0x01,0x00,0x00,0x00,  // y
+0x00,0xC4,0xA4,0x94,0x8C,0x84,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // z
+0x00,0x00,0x30,0xCF,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x02,0x00,0x00,  // {
+0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,  // |
+0x00,0x00,0x01,0xCF,0x30,0x00,0x00,0x00,0x00,0x02,0x03,0x00,0x00,0x00,  // }
+0x00,0x18,0x08,0x08,0x10,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ~
+};
+
+static const uint8_t Font11x18_Pages [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // sp
+0x00,0x00,0x00,0x00,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0x6F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // !
+0x00,0x00,0x00,0x3E,0x3E,0x00,0x3E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // "
+0x00,0x60,0x60,0xFE,0xFE,0x60,0x60,0xFE,0xFE,0x60,0x00,0x00,0x06,0x7F,0x7F,0x06,0x06,0x7F,0x7F,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // #
+0x00,0x38,0x7C,0xEE,0xC6,0xFE,0x86,0x1C,0x18,0x00,0x00,0x00,0x1C,0x3C,0x70,0x60,0xFF,0x61,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,  // $
+0x3C,0x7E,0x42,0x7E,0x3C,0x80,0xC0,0x60,0x30,0x18,0x00,0x00,0x18,0x0C,0x06,0x03,0x3D,0x7E,0x42,0x7E,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // %
+0x00,0x00,0x3C,0x7E,0xC6,0xC6,0x7E,0x3C,0x00,0x00,0x00,0x00,0x1E,0x3F,0x61,0x61,0x63,0x36,0x1C,0x7F,0x23,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // &
+0x00,0x00,0x00,0x00,0x3E,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '
+0x00,0x00,0x00,0x00,0xC0,0xF8,0x1C,0x06,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x7F,0xE0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,0x00,0x00,  // (
+0x00,0x00,0x01,0x06,0x1C,0xF8,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0x7F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // )
+0x00,0x00,0x2C,0x38,0x1E,0x1E,0x38,0x2C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // *
+0x80,0x80,0x80,0x80,0xF8,0xF8,0x80,0x80,0x80,0x80,0x00,0x01,0x01,0x01,0x01,0x1F,0x1F,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // +
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00,  // ,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // -
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // .
+0x00,0x00,0x00,0x00,0x00,0xF0,0xFE,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x7F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // /
+0x00,0xF0,0xFC,0x0E,0x86,0x86,0x0E,0xFC,0xF0,0x00,0x00,0x00,0x0F,0x3F,0x70,0x61,0x61,0x70,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 0
+0x00,0x00,0x30,0x18,0x0C,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 1
+0x00,0x38,0x3C,0x0E,0x06,0x06,0x8E,0xFC,0x78,0x00,0x00,0x00,0x70,0x78,0x6C,0x66,0x63,0x61,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 2
+0x00,0x18,0x1C,0x06,0xC6,0xC6,0xFC,0x38,0x00,0x00,0x00,0x00,0x18,0x38,0x70,0x60,0x60,0x71,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 3
+0x00,0x00,0x80,0xF0,0x3C,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x0E,0x0F,0x0D,0x0C,0x7F,0x7F,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 4
+0x00,0xFE,0xFE,0x86,0xC6,0xC6,0xC6,0x86,0x00,0x00,0x00,0x00,0x19,0x39,0x70,0x60,0x60,0x71,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 5
+0x00,0xF0,0xFC,0x8E,0xC6,0xC6,0xCE,0x9C,0x18,0x00,0x00,0x00,0x0F,0x3F,0x71,0x60,0x60,0x71,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 6
+0x00,0x06,0x06,0x06,0x06,0xC6,0xF6,0x3E,0x0E,0x00,0x00,0x00,0x00,0x00,0x70,0x7F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 7
+0x00,0x38,0x7C,0x86,0x86,0x86,0x8E,0x7C,0x38,0x00,0x00,0x00,0x1E,0x3F,0x61,0x61,0x61,0x61,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 8
+0x00,0xF8,0xFC,0x8E,0x06,0x06,0x8E,0xFC,0xF0,0x00,0x00,0x00,0x18,0x39,0x73,0x63,0x63,0x71,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 9
+0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // :
+0x00,0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00,  // ;
+0x00,0x00,0x80,0x80,0xC0,0x40,0x60,0x20,0x30,0x00,0x00,0x00,0x01,0x03,0x02,0x06,0x04,0x0C,0x08,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <
+0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // =
+0x00,0x30,0x20,0x60,0x40,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,0x18,0x08,0x0C,0x04,0x06,0x02,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // >
+0x00,0x18,0x1C,0x0E,0x06,0x06,0x86,0xCE,0xFC,0x78,0x00,0x00,0x00,0x00,0x00,0x6E,0x6F,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ?
+0x00,0xF0,0xFC,0x1E,0xC6,0xC6,0x66,0xFC,0xF8,0x00,0x00,0x00,0x0F,0x3F,0x70,0x63,0x67,0x36,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // @
+0x00,0x00,0x80,0xF8,0x7E,0x06,0x7E,0xF8,0x80,0x00,0x00,0x00,0x70,0x7F,0x0F,0x06,0x06,0x06,0x0F,0x7F,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // A
+0x00,0xFE,0xFE,0x86,0x86,0x86,0xFC,0x78,0x00,0x00,0x00,0x00,0x7F,0x7F,0x61,0x61,0x61,0x73,0x3E,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // B
+0x00,0xF0,0xFC,0x0E,0x06,0x06,0x06,0x1C,0x18,0x00,0x00,0x00,0x0F,0x3F,0x70,0x60,0x60,0x60,0x38,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // C
+0x00,0xFE,0xFE,0x06,0x06,0x06,0x1C,0xFC,0xF0,0x00,0x00,0x00,0x7F,0x7F,0x60,0x60,0x60,0x38,0x1F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // D
+0x00,0xFE,0xFE,0x86,0x86,0x86,0x86,0x86,0x06,0x00,0x00,0x00,0x7F,0x7F,0x61,0x61,0x61,0x61,0x61,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // E
+0x00,0xFE,0xFE,0x86,0x86,0x86,0x86,0x86,0x06,0x00,0x00,0x00,0x7F,0x7F,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // F
+0x00,0xF0,0xFC,0x0E,0x06,0x06,0x06,0x1C,0x18,0x00,0x00,0x00,0x0F,0x3F,0x70,0x60,0x60,0x63,0x3F,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // G
+0x00,0xFE,0xFE,0x80,0x80,0x80,0x80,0xFE,0xFE,0x00,0x00,0x00,0x7F,0x7F,0x01,0x01,0x01,0x01,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // H
+0x00,0x00,0x06,0x06,0xFE,0xFE,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x7F,0x7F,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // I
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFE,0x00,0x00,0x00,0x1C,0x3C,0x70,0x60,0x60,0x70,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // J
+0x00,0xFE,0xFE,0x80,0xC0,0x70,0x38,0x0C,0x06,0x02,0x00,0x00,0x7F,0x7F,0x01,0x01,0x07,0x0E,0x38,0x70,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // K
+0x00,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // L
+0x00,0xFE,0xFE,0x1E,0xF8,0x80,0xF8,0x0E,0xFE,0xFE,0x00,0x00,0x7F,0x7F,0x00,0x00,0x01,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // M
+0x00,0xFE,0xFE,0x3E,0xF8,0xC0,0x00,0xFE,0xFE,0x00,0x00,0x00,0x7F,0x7F,0x00,0x01,0x1F,0x7C,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // N
+0x00,0xF0,0xFC,0x0E,0x06,0x06,0x0E,0xFC,0xF0,0x00,0x00,0x00,0x0F,0x3F,0x70,0x60,0x60,0x70,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // O
+0x00,0xFE,0xFE,0x06,0x06,0x06,0x8E,0xFC,0xF8,0x00,0x00,0x00,0x7F,0x7F,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // P
+0x00,0xF0,0xFC,0x0E,0x06,0x06,0x0E,0xFC,0xF0,0x00,0x00,0x00,0x0F,0x3F,0x70,0x60,0x6C,0x78,0x3F,0x2F,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // Q
+0x00,0xFE,0xFE,0x86,0x86,0x86,0xCE,0xFC,0x78,0x00,0x00,0x00,0x7F,0x7F,0x01,0x01,0x03,0x0F,0x3C,0x70,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // R
+0x00,0x00,0x78,0xFC,0xC6,0x86,0x86,0x1C,0x18,0x00,0x00,0x00,0x0C,0x3C,0x70,0x60,0x61,0x63,0x3F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // S
+0x06,0x06,0x06,0x06,0xFE,0xFE,0x06,0x06,0x06,0x06,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // T
+0x00,0xFE,0xFE,0x00,0x00,0x00,0x00,0xFE,0xFE,0x00,0x00,0x00,0x1F,0x3F,0x70,0x60,0x60,0x70,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // U
+0x00,0x0E,0x7E,0xF0,0x80,0x00,0x80,0xF0,0x7E,0x0E,0x00,0x00,0x00,0x00,0x07,0x3F,0x78,0x3F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // V
+0x7E,0xFE,0x00,0x00,0xC0,0xC0,0x00,0x00,0xFE,0x7E,0x00,0x00,0x7F,0x70,0x1E,0x03,0x03,0x1E,0x70,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // W
+0x02,0x0E,0x3C,0x70,0xE0,0xC0,0x70,0x38,0x0E,0x02,0x00,0x40,0x70,0x38,0x1E,0x0F,0x07,0x0E,0x3C,0x70,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // X
+0x02,0x0E,0x3C,0xF0,0xC0,0xC0,0xF0,0x3C,0x0E,0x02,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // Y
+0x00,0x00,0x06,0x06,0x86,0xC6,0x76,0x3E,0x0E,0x00,0x00,0x00,0x70,0x78,0x6E,0x67,0x61,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // Z
+0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00,  // [
+0x00,0x00,0x00,0x0E,0xFE,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x7F,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // backslash
+0x00,0x00,0x00,0x03,0x03,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,  // ]
+0x00,0x80,0xE0,0x78,0x0E,0x0E,0x78,0xE0,0x80,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ^
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,  // _
+0x00,0x00,0x02,0x06,0x0E,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // `
+0x00,0x80,0xC0,0x60,0x60,0x60,0x60,0xE0,0xC0,0x00,0x00,0x00,0x38,0x7C,0x66,0x66,0x26,0x36,0x3F,0x7F,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // a
+0x00,0xFE,0xFE,0xC0,0x60,0x60,0xE0,0xC0,0x80,0x00,0x00,0x00,0x7F,0x7F,0x30,0x60,0x60,0x70,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // b
+0x00,0x80,0xC0,0xE0,0x60,0x60,0xE0,0xC0,0x80,0x00,0x00,0x00,0x1F,0x3F,0x70,0x60,0x60,0x70,0x39,0x19,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // c
+0x00,0x80,0xC0,0xE0,0x60,0x60,0xC0,0xFE,0xFE,0x00,0x00,0x00,0x1F,0x3F,0x70,0x60,0x60,0x30,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // d
+0x00,0x80,0xC0,0xE0,0x60,0x60,0xE0,0xC0,0x00,0x00,0x00,0x00,0x1F,0x3F,0x76,0x66,0x66,0x66,0x37,0x17,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // e
+0x00,0x60,0x60,0x60,0xFC,0xFE,0x66,0x66,0x66,0x06,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // f
+0x00,0xC0,0xE0,0x70,0x30,0x30,0x60,0xF0,0xF0,0x00,0x00,0x00,0x8F,0x9F,0x38,0x30,0x30,0x98,0xFF,0xFF,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,  // g
+0x00,0xFE,0xFE,0xC0,0x60,0x60,0x60,0xE0,0xC0,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // h
+0x00,0x00,0x60,0x60,0x60,0xE6,0xE6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // i
+0x00,0x00,0x30,0x30,0x30,0xF3,0xF3,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,  // j
+0x00,0xFE,0xFE,0x00,0x00,0x80,0xC0,0x60,0x20,0x00,0x00,0x00,0x7F,0x7F,0x06,0x03,0x07,0x1C,0x38,0x60,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // k
+0x00,0x00,0x06,0x06,0x06,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // l
+0xE0,0xE0,0x40,0x60,0xE0,0xE0,0xC0,0x60,0xE0,0xC0,0x00,0x7F,0x7F,0x00,0x00,0x7F,0x7F,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // m
+0x00,0xE0,0xE0,0xC0,0x60,0x60,0x60,0xE0,0xC0,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // n
+0x00,0x80,0xC0,0xE0,0x60,0x60,0xE0,0xC0,0x80,0x00,0x00,0x00,0x1F,0x3F,0x70,0x60,0x60,0x70,0x3F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // o
+0x00,0xF0,0xF0,0x60,0x30,0x30,0x70,0xE0,0xC0,0x00,0x00,0x00,0xFF,0xFF,0x18,0x30,0x30,0x38,0x1F,0x0F,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // p
+0x00,0xC0,0xE0,0x70,0x30,0x30,0x60,0xF0,0xF0,0x00,0x00,0x00,0x0F,0x1F,0x38,0x30,0x30,0x18,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,  // q
+0x00,0x20,0xE0,0xC0,0xC0,0x60,0x60,0xE0,0x40,0x00,0x00,0x00,0x00,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // r
+0x00,0x80,0xC0,0x60,0x60,0x60,0x60,0xC0,0xC0,0x00,0x00,0x00,0x33,0x37,0x66,0x66,0x66,0x66,0x3E,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // s
+0x00,0x60,0x60,0xF8,0xFC,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x7F,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // t
+0x00,0xE0,0xE0,0x00,0x00,0x00,0x00,0xE0,0xE0,0x00,0x00,0x00,0x3F,0x7F,0x60,0x60,0x60,0x30,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // u
+0x00,0x20,0xE0,0xC0,0x00,0x00,0x00,0xC0,0xE0,0x20,0x00,0x00,0x00,0x01,0x0F,0x3E,0x70,0x7E,0x0F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // v
+0xE0,0xE0,0x00,0xE0,0xE0,0xE0,0x00,0xE0,0xE0,0x00,0x00,0x00,0x1F,0x78,0x1F,0x00,0x1F,0x78,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // w
+0x00,0x20,0xE0,0xC0,0x00,0x00,0xC0,0xE0,0x20,0x00,0x00,0x00,0x40,0x70,0x39,0x0F,0x0F,0x39,0x70,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // x
+0x00,0x30,0xF0,0xC0,0x00,0x00,0x80,0xF0,0x70,0x00,0x00,0x00,0x00,0x01,0x8F,0xFE,0xF0,0x7F,0x0F,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,  // y
+0x00,0x60,0x60,0x60,0x60,0x60,0x60,0xE0,0xE0,0x60,0x00,0x00,0x60,0x70,0x78,0x6C,0x66,0x63,0x61,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // z
+0x00,0x00,0x00,0x00,0x80,0xFE,0xFF,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x07,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x00,0x00,  // {
+0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x00,0x00,0x00,  // |
+0x00,0x00,0x03,0x03,0xFF,0xFE,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,  // }
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x03,0x01,0x01,0x01,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ~
+};
+
+static const uint8_t Font16x26_Pages [] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // sp
+0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x7F,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // !
+0x00,0x00,0x00,0x7F,0x7F,0x7F,0x7F,0x00,0x00,0x00,0x7F,0x7F,0x7F,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // "
+0x00,0x80,0xC0,0xC0,0xC0,0xE0,0xFE,0xFF,0xFF,0xC7,0xC0,0xFC,0xFF,0xFF,0xCF,0xC0,0x60,0x60,0x60,0xE0,0xFE,0xFF,0xFF,0x6F,0xE0,0xFC,0xFF,0xFF,0x7F,0x60,0x60,0x60,0x00,0x00,0x1C,0x1F,0x1F,0x0F,0x00,0x18,0x1F,0x1F,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // #
+0x00,0x00,0x00,0xFC,0xFE,0xFE,0xFF,0x87,0xFF,0xFF,0xFF,0x03,0x07,0x07,0x06,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x07,0xFF,0xFF,0xFF,0xFF,0xFC,0xF8,0xF8,0xF0,0x00,0x00,0x00,0x0C,0x0C,0x1C,0x1C,0x18,0x7F,0x7F,0x7F,0x7F,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // $
+0xFE,0xFE,0xFF,0x03,0x01,0xCF,0xFF,0xFE,0xFC,0x80,0xE0,0xF0,0xFC,0x3E,0x1F,0x07,0x01,0x01,0x03,0x83,0xC2,0xF3,0xFB,0x7F,0xFF,0xFF,0xFB,0xF9,0x18,0x18,0xF8,0xF8,0x18,0x1C,0x1F,0x0F,0x07,0x01,0x00,0x00,0x07,0x0F,0x1F,0x1F,0x18,0x18,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // %
+0x00,0x00,0x00,0x38,0xFE,0xFF,0xFF,0xFF,0x83,0xFF,0xFF,0xFE,0x7E,0x00,0x00,0x00,0xF8,0xFC,0xFC,0xFE,0x0F,0x07,0x1F,0x3F,0xFF,0xFD,0xF1,0xE0,0x80,0xF0,0xFC,0xFC,0x03,0x07,0x0F,0x1F,0x1E,0x1C,0x18,0x18,0x18,0x1D,0x1F,0x0F,0x1F,0x1F,0x1F,0x1D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // &
+0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x7F,0x7F,0x7F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '
+0x00,0x00,0x00,0x00,0x00,0xE0,0xF0,0xFC,0xFC,0x3E,0x0F,0x07,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x0F,0x3F,0x3F,0x7C,0xF0,0xE0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,  // (
+0x00,0x01,0x01,0x03,0x03,0x07,0x0F,0x3E,0xFC,0xFC,0xF0,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xE0,0xF0,0x7C,0x3F,0x3F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // )
+0x00,0x00,0x38,0x38,0x38,0x30,0xF3,0xFF,0x1F,0xBF,0xF1,0xB0,0x38,0x38,0x38,0x30,0x00,0x00,0x00,0x04,0x06,0x0F,0x0F,0x07,0x01,0x03,0x0F,0x0F,0x0F,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // *
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0xFF,0xFF,0xFF,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // +
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,  // ,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // -
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x1E,0x1E,0x1E,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // .
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xFC,0xFF,0x3F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xFC,0xFF,0x3F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xFC,0xFF,0x3F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // /
+0x00,0xE0,0xF8,0xFC,0xFE,0x7F,0x0F,0x07,0x03,0x07,0x0F,0x7F,0xFE,0xFC,0xF8,0xE0,0x00,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x03,0x07,0x0F,0x1F,0x1E,0x1C,0x18,0x1C,0x1E,0x1F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 0
+0x00,0x00,0x0C,0x0C,0x0C,0x0E,0x0E,0xFE,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x1F,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 1
+0x00,0x00,0x06,0x06,0x07,0x07,0x03,0x03,0x03,0x07,0xFF,0xFE,0xFE,0xFC,0x70,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0xF0,0xF8,0x7C,0x3E,0x1F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x1E,0x1F,0x1F,0x1F,0x1B,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 2
+0x00,0x00,0x00,0x06,0x07,0x07,0x03,0x03,0x03,0x07,0xFF,0xFF,0xFE,0xFC,0x38,0x00,0x00,0x00,0x00,0x00,0x06,0x06,0x06,0x06,0x07,0x0F,0x1F,0xFF,0xFD,0xF8,0xF0,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 3
+0x00,0x00,0x00,0x00,0x80,0xE0,0xF0,0xF8,0x7E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x60,0x78,0x7C,0x7F,0x7F,0x67,0x63,0x60,0x60,0xFF,0xFF,0xFF,0xFF,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 4
+0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x07,0x0F,0xBF,0xFE,0xFE,0xFC,0xF0,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 5
+0x00,0x00,0xE0,0xF8,0xFC,0xFE,0x3E,0x0F,0x07,0x03,0x03,0x03,0x07,0x07,0x06,0x00,0x00,0x0C,0xFF,0xFF,0xFF,0xFF,0x0E,0x07,0x03,0x03,0x07,0x0F,0xFF,0xFE,0xFC,0xF8,0x00,0x00,0x01,0x07,0x0F,0x0F,0x1F,0x1C,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 6
+0x00,0x00,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xC7,0xF7,0xFF,0x7F,0x3F,0x0F,0x00,0x00,0x00,0x00,0x00,0x80,0xE0,0xF8,0xFE,0x7F,0x1F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x1F,0x1F,0x1F,0x1F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 7
+0x00,0x00,0x30,0xFC,0xFE,0xFF,0xFF,0x87,0x03,0x03,0x87,0xFF,0xFF,0xFE,0x7C,0x00,0x00,0xC0,0xF0,0xF8,0xFD,0xFF,0x1F,0x07,0x0F,0x0F,0x1F,0x7F,0xFD,0xF8,0xF0,0xE0,0x00,0x01,0x07,0x0F,0x0F,0x1F,0x1C,0x1C,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 8
+0x00,0xE0,0xF8,0xFC,0xFE,0xFF,0x07,0x03,0x03,0x07,0x0F,0xFF,0xFE,0xFC,0xF8,0xE0,0x00,0x01,0x07,0x0F,0x0F,0x1F,0x1C,0x18,0x18,0x18,0x1C,0xEF,0xFF,0xFF,0xFF,0x3F,0x00,0x00,0x0C,0x1C,0x1C,0x18,0x18,0x18,0x1C,0x1C,0x1F,0x0F,0x07,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 9
+0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x1E,0x1E,0x1E,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // :
+0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0xFE,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,  // ;
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0x20,0x20,0x70,0x70,0xF8,0xF8,0xFC,0xDC,0x8E,0x8E,0x07,0x07,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x03,0x03,0x07,0x07,0x0E,0x0E,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x8C,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // =
+0xC0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x03,0x03,0x07,0x07,0x8E,0x8E,0xDC,0xDC,0xF8,0xF8,0x70,0x70,0x20,0x18,0x1C,0x1C,0x0E,0x0E,0x07,0x07,0x03,0x03,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // >
+0x00,0x00,0x1E,0x1F,0x1F,0x03,0x03,0x03,0x03,0x03,0x87,0xFF,0xFE,0xFE,0x7C,0x18,0x00,0x00,0x00,0x00,0x00,0x60,0x78,0x7C,0x7E,0x7F,0x07,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ?
+0x00,0xE0,0xF8,0xFC,0x7E,0x1E,0x8F,0xC7,0xE3,0xF3,0x73,0x37,0x7F,0xFE,0xFE,0xF8,0x3F,0xFF,0xFF,0xFF,0x80,0x00,0xFF,0xFF,0xFF,0xC1,0xC0,0xF0,0xFE,0xFF,0xFF,0xFF,0x00,0x01,0x03,0x07,0x0F,0x0E,0x1C,0x1D,0x19,0x19,0x19,0x1D,0x1C,0x0D,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // @
+0x00,0x00,0x00,0x00,0x00,0xE0,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF8,0xFF,0xFF,0xDF,0xC3,0xC0,0xC7,0xFF,0xFF,0xFF,0xFC,0xE0,0x80,0x1C,0x1F,0x1F,0x1F,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x07,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // A
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x38,0xF8,0xF8,0xF0,0xE0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x18,0x18,0x18,0x3C,0x3E,0xFF,0xF7,0xE7,0xE3,0xC0,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // B
+0x00,0x00,0xC0,0xE0,0xE0,0xF0,0x70,0x38,0x38,0x18,0x18,0x18,0x18,0x38,0x38,0x38,0x00,0xFF,0xFF,0xFF,0xFF,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x07,0x07,0x0F,0x0F,0x1E,0x1C,0x18,0x18,0x18,0x18,0x18,0x1C,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // C
+0x00,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x38,0x38,0xF8,0xF0,0xF0,0xE0,0xC0,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x1C,0x1C,0x0F,0x0F,0x07,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // D
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // E
+0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // F
+0x00,0x80,0xC0,0xE0,0xF0,0xF0,0x78,0x38,0x38,0x18,0x18,0x18,0x18,0x38,0x38,0x30,0x3C,0xFF,0xFF,0xFF,0xFF,0x81,0x00,0x00,0x00,0x30,0x30,0x30,0xF0,0xF0,0xF0,0xF0,0x00,0x01,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x1C,0x18,0x18,0x18,0x1F,0x1F,0x1F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // G
+0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x18,0x18,0x18,0x18,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // H
+0x00,0x00,0x18,0x18,0x18,0x18,0xF8,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x1F,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // I
+0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // J
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x80,0xC0,0xE0,0xF8,0x78,0x38,0x18,0x08,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x3E,0x7F,0xFF,0xF7,0xE3,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x03,0x07,0x0F,0x1F,0x1E,0x1C,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // K
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // L
+0xF8,0xF8,0xF8,0xF8,0xF8,0xF0,0xC0,0x00,0x00,0x00,0xC0,0xF8,0xF8,0xF8,0xF8,0xF8,0xFF,0xFF,0xFF,0xFF,0x0F,0x3F,0xFF,0xFE,0xF0,0xFE,0xFF,0x1F,0x03,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // M
+0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0xE0,0xC0,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x00,0xFF,0xFF,0xFF,0xFF,0x07,0x0F,0x3F,0xFF,0xFC,0xF8,0xE0,0xFF,0xFF,0xFF,0xFF,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x01,0x07,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // N
+0x00,0xC0,0xE0,0xF0,0xF0,0x78,0x38,0x18,0x18,0x18,0x38,0x78,0xF0,0xF0,0xE0,0xC0,0x7E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x18,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // O
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x38,0xF8,0xF8,0xF0,0xF0,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x30,0x30,0x30,0x38,0x3C,0x1F,0x1F,0x0F,0x0F,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // P
+0x00,0xC0,0xE0,0xF0,0xF0,0x78,0x38,0x18,0x18,0x18,0x38,0x78,0xF0,0xF0,0xE0,0xC0,0x7E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x18,0x18,0x38,0x7C,0x7E,0xFF,0xEF,0xC7,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,  // Q
+0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x38,0x78,0xF8,0xF0,0xF0,0xE0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x30,0x70,0xF8,0xF8,0xFE,0xDF,0x8F,0x0F,0x03,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x01,0x03,0x0F,0x1F,0x1F,0x1E,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // R
+0x00,0x00,0xE0,0xF0,0xF0,0xF8,0x38,0x18,0x18,0x18,0x18,0x18,0x38,0x38,0x30,0x00,0x00,0x00,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x1C,0x3C,0x38,0x78,0xF8,0xF0,0xF0,0xE0,0x00,0x00,0x0E,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x18,0x1C,0x1E,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // S
+0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0xF8,0xF8,0xF8,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // T
+0x00,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0xF8,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x07,0x0F,0x0F,0x1F,0x1C,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // U
+0x38,0xF8,0xF8,0xF8,0xE0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF8,0xF8,0xF8,0x00,0x00,0x07,0x3F,0xFF,0xFF,0xFC,0xF0,0x80,0xE0,0xF8,0xFF,0xFF,0x1F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x1F,0x1F,0x1F,0x1F,0x1F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // V
+0xF8,0xF8,0xF8,0xF0,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0xC0,0xF8,0xF8,0x03,0xFF,0xFF,0xFF,0xF8,0xF0,0xFF,0xFF,0x3F,0xFF,0xFF,0xF8,0xE0,0xFF,0xFF,0xFF,0x00,0x01,0x1F,0x1F,0x1F,0x1F,0x1F,0x03,0x00,0x03,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // W
+0x08,0x18,0x78,0xF8,0xF8,0xF0,0xE0,0x80,0x00,0x00,0xC0,0xE0,0xF0,0xF8,0x78,0x18,0x00,0x00,0x00,0x00,0xC1,0xE7,0xFF,0xFF,0x7F,0xFF,0xFF,0xE3,0xC1,0x80,0x00,0x00,0x10,0x1C,0x1E,0x1F,0x0F,0x03,0x01,0x00,0x00,0x01,0x03,0x07,0x1F,0x1F,0x1E,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // X
+0x08,0x38,0xF8,0xF8,0xF8,0xE0,0x80,0x00,0x00,0x00,0x00,0xC0,0xE0,0xF8,0xF8,0x38,0x00,0x00,0x00,0x01,0x07,0x0F,0xFF,0xFF,0xFC,0xFE,0xFF,0x0F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // Y
+0x00,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x98,0xD8,0xF8,0xF8,0xF8,0x78,0x00,0x00,0x00,0x00,0xC0,0xE0,0xF0,0xF8,0x7E,0x3F,0x1F,0x07,0x03,0x01,0x00,0x00,0x00,0x1C,0x1E,0x1F,0x1F,0x1F,0x1B,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // Z
+0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,  // [
+0x00,0x03,0x0F,0x3F,0xFF,0xFC,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3F,0xFF,0xFC,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0F,0x3F,0xFF,0xFC,0xF0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,  // backslash
+0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,  // ]
+0x00,0x00,0x00,0x00,0x00,0xE0,0xF8,0xFE,0x7F,0xFF,0xF8,0xE0,0x80,0x00,0x00,0x00,0x00,0x80,0xF0,0xFC,0xFF,0x3F,0x0F,0x03,0x00,0x01,0x0F,0x3F,0xFF,0xFC,0xF0,0xC0,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ^
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // _
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // `
+0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x80,0xC1,0xE1,0xE1,0xF1,0x70,0x30,0x30,0x31,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x07,0x0F,0x1F,0x1F,0x1E,0x18,0x18,0x18,0x1C,0x0F,0x0F,0x1F,0x1F,0x1F,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // a
+0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x03,0x01,0x00,0x00,0x01,0x03,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x1F,0x1F,0x0F,0x1C,0x1C,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // b
+0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x70,0xFE,0xFF,0xFF,0xFF,0x07,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x03,0x07,0x0F,0x0F,0x1F,0x1C,0x1C,0x18,0x18,0x18,0x18,0x1C,0x1C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // c
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0xFF,0x9F,0x01,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x01,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x18,0x1C,0x0E,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // d
+0x00,0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0xF8,0xFE,0xFF,0xFF,0xFF,0x33,0x31,0x30,0x30,0x31,0x3F,0x3F,0x3F,0x3F,0x3C,0x00,0x00,0x03,0x07,0x0F,0x0F,0x1E,0x1C,0x18,0x18,0x18,0x18,0x18,0x1C,0x1C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // e
+0x00,0xC0,0xC0,0xC0,0xC0,0xF8,0xFE,0xFF,0xFF,0xFF,0xC3,0xC1,0xC1,0xC1,0xC1,0xC3,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // f
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0x00,0xFC,0xFF,0xFF,0xFF,0x8F,0x01,0x00,0x00,0x01,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x01,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x18,0x1C,0x0E,0xFF,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0x03,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,0x03,0x03,0x01,0x00,0x00,  // g
+0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x07,0x03,0x01,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // h
+0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC3,0xC3,0xC3,0xC3,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // i
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC3,0xC3,0xC3,0xC3,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x7F,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x02,0x02,0x02,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,  // j
+0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0xC0,0x40,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x70,0xFC,0xFE,0xFF,0xCF,0x87,0x03,0x01,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x01,0x03,0x07,0x1F,0x1F,0x1E,0x1C,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // k
+0x00,0x01,0x01,0x01,0x01,0x01,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // l
+0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0x80,0xFF,0xFF,0xFF,0xFF,0x0F,0x03,0x07,0xFF,0xFF,0xFF,0x0F,0x03,0x03,0xFF,0xFF,0xFF,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // m
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x07,0x03,0x01,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // n
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x01,0x00,0x00,0x00,0x01,0x07,0xFF,0xFF,0xFF,0xFE,0x00,0x01,0x07,0x0F,0x0F,0x1F,0x1C,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // o
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x80,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x03,0x01,0x00,0x00,0x01,0x03,0xFF,0xFF,0xFF,0xFE,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x1E,0x1C,0x18,0x18,0x1C,0x1F,0x1F,0x0F,0x07,0x01,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // p
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x07,0x01,0x00,0x00,0x01,0x01,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x03,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x18,0x1C,0x0E,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,  // q
+0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x03,0x01,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // r
+0x00,0x00,0x00,0x80,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x0E,0x1F,0x1F,0x3F,0x3F,0x38,0x70,0x70,0xF0,0xE0,0xE1,0xE1,0xC1,0x00,0x00,0x00,0x0C,0x1C,0x1C,0x1C,0x18,0x18,0x18,0x18,0x1C,0x1F,0x0F,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // s
+0x00,0xC0,0xC0,0xC0,0xC0,0xF8,0xF8,0xF8,0xF8,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // t
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x07,0x0F,0x1F,0x1F,0x1C,0x18,0x1C,0x1E,0x0F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // u
+0x40,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0x00,0x01,0x0F,0x3F,0xFF,0xFE,0xF8,0xC0,0x00,0xC0,0xF0,0xFE,0xFF,0x3F,0x0F,0x01,0x00,0x00,0x00,0x00,0x01,0x07,0x1F,0x1F,0x1F,0x1F,0x1F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // v
+0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0xC0,0xC0,0x0F,0xFF,0xFF,0xFF,0xF0,0xF0,0xFF,0xFF,0x1F,0xFF,0xFF,0xFC,0xC0,0xFE,0xFF,0xFF,0x00,0x01,0x1F,0x1F,0x1F,0x1F,0x1F,0x01,0x00,0x01,0x1F,0x1F,0x1F,0x1F,0x1F,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // w
+0x00,0x40,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0x40,0x00,0x00,0x01,0x03,0x07,0xDF,0xFF,0xFE,0xFC,0xFC,0xFF,0xDF,0x87,0x03,0x00,0x00,0x00,0x10,0x1C,0x1E,0x1F,0x0F,0x07,0x01,0x01,0x03,0x07,0x1F,0x1F,0x1E,0x1C,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // x
+0x40,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0x00,0x01,0x07,0x3F,0xFF,0xFF,0xF8,0xE0,0x80,0xC0,0xF8,0xFE,0xFF,0x3F,0x07,0x01,0x00,0x00,0x00,0x00,0x00,0x83,0xFF,0xFF,0xFF,0x7F,0x0F,0x03,0x00,0x00,0x00,0x00,0x00,0x02,0x02,0x02,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // y
+0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x80,0xC0,0xE0,0xF0,0xF8,0x7C,0x3E,0x1F,0x0F,0x07,0x03,0x01,0x00,0x18,0x1C,0x1F,0x1F,0x1F,0x1B,0x19,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // z
+0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0xC3,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x3C,0xFF,0xFF,0xE7,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0xFF,0xFF,0xFF,0xC3,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,  // {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,  // |
+0x00,0x00,0x01,0x01,0x01,0x01,0x83,0xFF,0xFF,0xFF,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xE7,0xFF,0xFF,0x3C,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0xC1,0xFF,0xFF,0xFF,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // }
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xF0,0xF8,0xF8,0x18,0x18,0x38,0x78,0x70,0xF0,0xE0,0xC0,0xC0,0xF8,0xF8,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ~
+};
+#endif
+
+
+// Packed proportional fonts (Tools/fonts/fontconv.c -p)
+static const uint8_t Font6x8P_Bits [] = {
+  // sp
+0x5F,  // !
+0xC7,0x01,  // "
+0x94,0x3F,0xE5,0x4F,0x01,  // #
+0x24,0xD5,0x5F,0x25,0x01,  // $
+0xA3,0x09,0x82,0x2C,0x06,  // %
+0xB6,0x64,0x55,0x04,0x05,  // &
+0x1D,  // '
+0x1C,0x51,0x10,  // (
+0x41,0x11,0x07,  // )
+0x8A,0x7C,0xA2,0x00,  // *
+0x84,0x7C,0x42,0x00,  // +
+0x1D,  // ,
+0x1F,  // -
+0x0F,  // .
+0x10,0x11,0x11,0x00,  // /
+0xBE,0x68,0xB2,0xE8,0x03,  // 0
+0xC2,0x3F,0x10,  // 1
+0xC2,0x70,0x34,0x69,0x04,  // 2
+0xA1,0x60,0x71,0x19,0x03,  // 3
+0x18,0x8A,0xE4,0x0F,0x01,  // 4
+0xA7,0x62,0xB1,0x98,0x03,  // 5
+0x3C,0x65,0x32,0x09,0x03,  // 6
+0x81,0x78,0xA2,0x30,0x00,  // 7
+0xB6,0x64,0x32,0x69,0x03,  // 8
+0x86,0x64,0x32,0xE5,0x01,  // 9
+0x7B,0x03,  // :
+0xEB,0x06,  // ;
+0x08,0x8A,0x28,0x08,  // <
+0x6D,0x5B,  // =
+0x41,0x11,0x05,0x01,  // >
+0x82,0x40,0x34,0x61,0x00,  // ?
+0xB2,0x64,0x3E,0xE8,0x03,  // @
+0xFE,0x48,0x24,0xE2,0x07,  // A
+0xFF,0x64,0x32,0x69,0x03,  // B
+0xBE,0x60,0x30,0x28,0x02,  // C
+0xFF,0x60,0x50,0xC4,0x01,  // D
+0xFF,0x64,0x32,0x19,0x04,  // E
+0xFF,0x44,0x22,0x11,0x00,  // F
+0xBE,0x60,0x32,0xA9,0x07,  // G
+0x7F,0x04,0x02,0xF1,0x07,  // H
+0xC1,0x7F,0x10,  // I
+0x20,0x60,0xF0,0x17,0x00,  // J
+0x7F,0x04,0x45,0x14,0x04,  // K
+0x7F,0x20,0x10,0x08,0x04,  // L
+0x7F,0x01,0x43,0xF0,0x07,  // M
+0x7F,0x02,0x02,0xF2,0x07,  // N
+0xBE,0x60,0x30,0xE8,0x03,  // O
+0xFF,0x44,0x22,0x61,0x00,  // P
+0xBE,0x60,0x34,0xE4,0x05,  // Q
+0xFF,0x44,0x26,0x65,0x04,  // R
+0xC6,0x64,0x32,0x19,0x03,  // S
+0x81,0xC0,0x3F,0x10,0x00,  // T
+0x3F,0x20,0x10,0xF8,0x03,  // U
+0x1F,0x10,0x10,0xF4,0x01,  // V
+0x3F,0x20,0x0E,0xF8,0x03,  // W
+0x63,0x0A,0x82,0x32,0x06,  // X
+0x07,0x04,0x1C,0x71,0x00,  // Y
+0xE1,0x68,0xB2,0x38,0x04,  // Z
+0xFF,0x60,0x10,  // [
+0x41,0x10,0x04,0x01,  // backslash
+0xC1,0xE0,0x1F,  // ]
+0x54,0x44,  // ^
+0x1F,  // _
+0x11,0x01,  // `
+0xA8,0xD6,0xEA,0x01,  // a
+0x7F,0x24,0x91,0x88,0x03,  // b
+0x2E,0xC6,0x88,0x00,  // c
+0x38,0x22,0x11,0xF9,0x07,  // d
+0xAE,0xD6,0x6A,0x00,  // e
+0x08,0x7F,0x22,0x20,0x00,  // f
+0x46,0x9A,0xA6,0x1F,  // g
+0x7F,0x04,0x81,0x80,0x07,  // h
+0xC4,0x3E,0x10,  // i
+0x20,0x20,0xB1,0x07,  // j
+0x7F,0x08,0x8A,0x08,  // k
+0xC1,0x3F,0x10,  // l
+0x3F,0x98,0xE0,0x01,  // m
+0x5F,0x84,0xE0,0x01,  // n
+0x2E,0xC6,0xE8,0x00,  // o
+0xBF,0x94,0x22,0x00,  // p
+0xA2,0x14,0xF3,0x01,  // q
+0x5F,0x84,0x20,0x00,  // r
+0xB2,0xD6,0x8A,0x00,  // s
+0x84,0x1F,0x11,0x08,0x02,  // t
+0x0F,0x42,0xF4,0x01,  // u
+0x07,0x41,0x74,0x00,  // v
+0x0F,0x32,0xF8,0x00,  // w
+0x51,0x11,0x15,0x01,  // x
+0x83,0x52,0xFA,0x00,  // y
+0x31,0xD7,0x19,0x01,  // z
+0x08,0x5B,0x10,  // {
+0x7F,  // |
+0x41,0x1B,0x02,  // }
+0x8A,0x28,  // ~
+0x96,0x69,  // U+00B0
+0x3F,0x04,0x21,0x1F,  // U+00B5
+};
+
+static const FontGlyph Font6x8P_Glyphs [] = {
+  {   0,  0,  0, 0,  0,  3},  // sp
+  {   0,  1,  7, 0,  0,  2},  // !
+  {   1,  3,  3, 0,  0,  4},  // "
+  {   3,  5,  7, 0,  0,  6},  // #
+  {   8,  5,  7, 0,  0,  6},  // $
+  {  13,  5,  7, 0,  0,  6},  // %
+  {  18,  5,  7, 0,  0,  6},  // &
+  {  23,  2,  3, 0,  0,  3},  // '
+  {  24,  3,  7, 0,  0,  4},  // (
+  {  27,  3,  7, 0,  0,  4},  // )
+  {  30,  5,  5, 0,  1,  6},  // *
+  {  34,  5,  5, 0,  1,  6},  // +
+  {  38,  2,  3, 0,  4,  3},  // ,
+  {  39,  5,  1, 0,  3,  6},  // -
+  {  40,  2,  2, 0,  5,  3},  // .
+  {  41,  5,  5, 0,  1,  6},  // /
+  {  45,  5,  7, 0,  0,  6},  // 0
+  {  50,  3,  7, 0,  0,  4},  // 1
+  {  53,  5,  7, 0,  0,  6},  // 2
+  {  58,  5,  7, 0,  0,  6},  // 3
+  {  63,  5,  7, 0,  0,  6},  // 4
+  {  68,  5,  7, 0,  0,  6},  // 5
+  {  73,  5,  7, 0,  0,  6},  // 6
+  {  78,  5,  7, 0,  0,  6},  // 7
+  {  83,  5,  7, 0,  0,  6},  // 8
+  {  88,  5,  7, 0,  0,  6},  // 9
+  {  93,  2,  5, 0,  1,  3},  // :
+  {  95,  2,  6, 0,  1,  3},  // ;
+  {  97,  4,  7, 0,  0,  5},  // <
+  { 101,  5,  3, 0,  2,  6},  // =
+  { 103,  4,  7, 0,  0,  5},  // >
+  { 107,  5,  7, 0,  0,  6},  // ?
+  { 112,  5,  7, 0,  0,  6},  // @
+  { 117,  5,  7, 0,  0,  6},  // A
+  { 122,  5,  7, 0,  0,  6},  // B
+  { 127,  5,  7, 0,  0,  6},  // C
+  { 132,  5,  7, 0,  0,  6},  // D
+  { 137,  5,  7, 0,  0,  6},  // E
+  { 142,  5,  7, 0,  0,  6},  // F
+  { 147,  5,  7, 0,  0,  6},  // G
+  { 152,  5,  7, 0,  0,  6},  // H
+  { 157,  3,  7, 0,  0,  4},  // I
+  { 160,  5,  7, 0,  0,  6},  // J
+  { 165,  5,  7, 0,  0,  6},  // K
+  { 170,  5,  7, 0,  0,  6},  // L
+  { 175,  5,  7, 0,  0,  6},  // M
+  { 180,  5,  7, 0,  0,  6},  // N
+  { 185,  5,  7, 0,  0,  6},  // O
+  { 190,  5,  7, 0,  0,  6},  // P
+  { 195,  5,  7, 0,  0,  6},  // Q
+  { 200,  5,  7, 0,  0,  6},  // R
+  { 205,  5,  7, 0,  0,  6},  // S
+  { 210,  5,  7, 0,  0,  6},  // T
+  { 215,  5,  7, 0,  0,  6},  // U
+  { 220,  5,  7, 0,  0,  6},  // V
+  { 225,  5,  7, 0,  0,  6},  // W
+  { 230,  5,  7, 0,  0,  6},  // X
+  { 235,  5,  7, 0,  0,  6},  // Y
+  { 240,  5,  7, 0,  0,  6},  // Z
+  { 245,  3,  7, 0,  0,  4},  // [
+  { 248,  5,  5, 0,  1,  6},  // backslash
+  { 252,  3,  7, 0,  0,  4},  // ]
+  { 255,  5,  3, 0,  0,  6},  // ^
+  { 257,  5,  1, 0,  6,  6},  // _
+  { 258,  3,  3, 0,  0,  4},  // `
+  { 260,  5,  5, 0,  2,  6},  // a
+  { 264,  5,  7, 0,  0,  6},  // b
+  { 269,  5,  5, 0,  2,  6},  // c
+  { 273,  5,  7, 0,  0,  6},  // d
+  { 278,  5,  5, 0,  2,  6},  // e
+  { 282,  5,  7, 0,  0,  6},  // f
+  { 287,  5,  6, 0,  1,  6},  // g
+  { 291,  5,  7, 0,  0,  6},  // h
+  { 296,  3,  7, 0,  0,  4},  // i
+  { 299,  4,  7, 0,  0,  5},  // j
+  { 303,  4,  7, 0,  0,  5},  // k
+  { 307,  3,  7, 0,  0,  4},  // l
+  { 310,  5,  5, 0,  2,  6},  // m
+  { 314,  5,  5, 0,  2,  6},  // n
+  { 318,  5,  5, 0,  2,  6},  // o
+  { 322,  5,  5, 0,  2,  6},  // p
+  { 326,  5,  5, 0,  2,  6},  // q
+  { 330,  5,  5, 0,  2,  6},  // r
+  { 334,  5,  5, 0,  2,  6},  // s
+  { 338,  5,  7, 0,  0,  6},  // t
+  { 343,  5,  5, 0,  2,  6},  // u
+  { 347,  5,  5, 0,  2,  6},  // v
+  { 351,  5,  5, 0,  2,  6},  // w
+  { 355,  5,  5, 0,  2,  6},  // x
+  { 359,  5,  5, 0,  2,  6},  // y
+  { 363,  5,  5, 0,  2,  6},  // z
+  { 367,  3,  7, 0,  0,  4},  // {
+  { 370,  1,  7, 0,  0,  2},  // |
+  { 371,  3,  7, 0,  0,  4},  // }
+  { 374,  5,  3, 0,  2,  6},  // ~
+  { 376,  4,  4, 0,  0,  5},  // U+00B0
+  { 378,  5,  6, 0,  2,  6},  // U+00B5
+};
+
+static const FontRange Font6x8P_Ranges [] = {
+  {0x0020,  95,   0},
+  {0x00B0,   1,  95},
+  {0x00B5,   1,  96},
+};
+
+// 97 glyphs: 382 bytes of bits + 776 bytes of glyphs + 24 bytes of ranges
+static const FontPacked Font6x8P_Packed = {3, Font6x8P_Ranges, Font6x8P_Glyphs, Font6x8P_Bits};
+
+static const uint8_t Font7x10P_Bits [] = {
+  // sp
+0xBF,  // !
+0xC7,0x01,  // "
+0xF4,0x2F,0x24,0xF4,0x2F,  // #
+0x66,0x12,0xFD,0x4F,0x24,0x07,  // $
+0x26,0x19,0x6E,0x94,0x62,  // %
+0x60,0x96,0x99,0x66,0x90,  // &
+0x07,  // '
+0xFC,0x08,0x14,0x20,  // (
+0x01,0x0A,0xC4,0x0F,  // )
+0x7A,0x0A,  // *
+0x84,0x7C,0x42,0x00,  // +
+0x07,  // ,
+0x07,  // -
+0x01,  // .
+0xC0,0x3C,0x03,  // /
+0x7E,0x81,0x89,0x81,0x7E,  // 0
+0x04,0x02,0xFF,  // 1
+0x86,0xC1,0xA1,0x91,0x8E,  // 2
+0x42,0x81,0x89,0x89,0x76,  // 3
+0x30,0x2C,0x22,0xFF,0x20,  // 4
+0x4F,0x89,0x89,0x89,0x71,  // 5
+0x7E,0x89,0x89,0x89,0x72,  // 6
+0x01,0xE1,0x19,0x05,0x03,  // 7
+0x76,0x89,0x89,0x89,0x76,  // 8
+0x4E,0x91,0x91,0x91,0x7E,  // 9
+0x21,  // :
+0x71,  // ;
+0x44,0xA9,0x18,0x01,  // <
+0x6D,0x5B,  // =
+0x31,0x2A,0x45,0x00,  // >
+0x02,0x01,0xB1,0x09,0x06,  // ?
+0x7E,0x81,0x99,0x95,0x1E,  // @
+0xE0,0x3E,0x21,0x3E,0xE0,  // A
+0xFF,0x89,0x89,0x89,0x76,  // B
+0x7E,0x81,0x81,0x81,0x42,  // C
+0xFF,0x81,0x81,0x42,0x3C,  // D
+0xFF,0x89,0x89,0x89,0x89,  // E
+0xFF,0x09,0x09,0x09,0x01,  // F
+0x7E,0x81,0x91,0x91,0x72,  // G
+0xFF,0x08,0x08,0x08,0xFF,  // H
+0x81,0xFF,0x81,  // I
+0x40,0x80,0x80,0x80,0x7F,  // J
+0xFF,0x08,0x14,0x62,0x81,  // K
+0xFF,0x80,0x80,0x80,0x80,  // L
+0xFF,0x06,0x08,0x06,0xFF,  // M
+0xFF,0x06,0x18,0x60,0xFF,  // N
+0x7E,0x81,0x81,0x81,0x7E,  // O
+0xFF,0x11,0x11,0x11,0x0E,  // P
+0x7E,0x02,0x05,0x0B,0xE4,0x17,  // Q
+0xFF,0x11,0x11,0x71,0x8E,  // R
+0x46,0x89,0x89,0x91,0x62,  // S
+0x01,0x01,0xFF,0x01,0x01,  // T
+0x7F,0x80,0x80,0x80,0x7F,  // U
+0x07,0x38,0xC0,0x38,0x07,  // V
+0x3F,0xE0,0x1C,0xE0,0x3F,  // W
+0x81,0x66,0x18,0x66,0x81,  // X
+0x03,0x0C,0xF0,0x0C,0x03,  // Y
+0xC1,0xA1,0x99,0x85,0x83,  // Z
+0xFF,0x07,0x08,  // [
+0x03,0x3C,0xC0,  // backslash
+0x01,0xFE,0x0F,  // ]
+0x68,0x61,0x08,  // ^
+0x7F,  // _
+0x09,  // `
+0x5A,0x59,0x56,0x3E,  // a
+0xFF,0x48,0x84,0x84,0x78,  // b
+0x5E,0x18,0x86,0x12,  // c
+0x78,0x84,0x84,0x48,0xFF,  // d
+0x5E,0x59,0x96,0x16,  // e
+0x04,0x04,0xFE,0x05,0x05,  // f
+0x9E,0xA1,0xA1,0x92,0x7F,  // g
+0xFF,0x08,0x04,0x04,0xF8,  // h
+0x04,0x04,0xFD,  // i
+0x00,0x12,0x48,0x60,0x7F,  // j
+0xFF,0x10,0x28,0x44,0x80,  // k
+0x01,0x01,0xFF,  // l
+0x7F,0xF0,0x07,0x3E,  // m
+0xBF,0x10,0x04,0x3E,  // n
+0x5E,0x18,0x86,0x1E,  // o
+0xFF,0x12,0x21,0x21,0x1E,  // p
+0x1E,0x21,0x21,0x12,0xFF,  // q
+0xBF,0x10,0x04,0x02,  // r
+0x52,0x59,0xA6,0x12,  // s
+0x04,0x7F,0x84,0x84,  // t
+0x1F,0x08,0x42,0x3F,  // u
+0x03,0x07,0x72,0x03,  // v
+0x0F,0x7E,0xE0,0x0F,  // w
+0xA1,0xC4,0x48,0x21,  // x
+0x83,0x8C,0x70,0x0C,0x03,  // y
+0x71,0x5A,0x8E,0x21,  // z
+0x30,0x3C,0x1F,0x20,  // {
+0xFF,0x03,  // |
+0x01,0x3E,0x0F,0x03,  // }
+0x97,0x03,  // ~
+0x96,0x69,  // U+00B0
+0xFF,0x20,0x20,0x10,0x3F,  // U+00B5
+};
+
+static const FontGlyph Font7x10P_Glyphs [] = {
+  {   0,  0,  0, 0,  0,  3},  // sp
+  {   0,  1,  8, 0,  0,  2},  // !
+  {   1,  3,  3, 0,  0,  4},  // "
+  {   3,  5,  8, 0,  0,  6},  // #
+  {   8,  5,  9, 0,  0,  6},  // $
+  {  14,  5,  8, 0,  0,  6},  // %
+  {  19,  5,  8, 0,  0,  6},  // &
+  {  24,  1,  3, 0,  0,  2},  // '
+  {  25,  3, 10, 0,  0,  4},  // (
+  {  29,  3, 10, 0,  0,  4},  // )
+  {  33,  3,  4, 0,  0,  4},  // *
+  {  35,  5,  5, 0,  2,  6},  // +
+  {  39,  1,  3, 0,  7,  2},  // ,
+  {  40,  3,  1, 0,  5,  4},  // -
+  {  41,  1,  1, 0,  7,  2},  // .
+  {  42,  3,  8, 0,  0,  4},  // /
+  {  45,  5,  8, 0,  0,  6},  // 0
+  {  50,  3,  8, 0,  0,  4},  // 1
+  {  53,  5,  8, 0,  0,  6},  // 2
+  {  58,  5,  8, 0,  0,  6},  // 3
+  {  63,  5,  8, 0,  0,  6},  // 4
+  {  68,  5,  8, 0,  0,  6},  // 5
+  {  73,  5,  8, 0,  0,  6},  // 6
+  {  78,  5,  8, 0,  0,  6},  // 7
+  {  83,  5,  8, 0,  0,  6},  // 8
+  {  88,  5,  8, 0,  0,  6},  // 9
+  {  93,  1,  6, 0,  2,  2},  // :
+  {  94,  1,  7, 0,  3,  2},  // ;
+  {  95,  5,  5, 0,  2,  6},  // <
+  {  99,  5,  3, 0,  3,  6},  // =
+  { 101,  5,  5, 0,  2,  6},  // >
+  { 105,  5,  8, 0,  0,  6},  // ?
+  { 110,  5,  8, 0,  0,  6},  // @
+  { 115,  5,  8, 0,  0,  6},  // A
+  { 120,  5,  8, 0,  0,  6},  // B
+  { 125,  5,  8, 0,  0,  6},  // C
+  { 130,  5,  8, 0,  0,  6},  // D
+  { 135,  5,  8, 0,  0,  6},  // E
+  { 140,  5,  8, 0,  0,  6},  // F
+  { 145,  5,  8, 0,  0,  6},  // G
+  { 150,  5,  8, 0,  0,  6},  // H
+  { 155,  3,  8, 0,  0,  4},  // I
+  { 158,  5,  8, 0,  0,  6},  // J
+  { 163,  5,  8, 0,  0,  6},  // K
+  { 168,  5,  8, 0,  0,  6},  // L
+  { 173,  5,  8, 0,  0,  6},  // M
+  { 178,  5,  8, 0,  0,  6},  // N
+  { 183,  5,  8, 0,  0,  6},  // O
+  { 188,  5,  8, 0,  0,  6},  // P
+  { 193,  5,  9, 0,  0,  6},  // Q
+  { 199,  5,  8, 0,  0,  6},  // R
+  { 204,  5,  8, 0,  0,  6},  // S
+  { 209,  5,  8, 0,  0,  6},  // T
+  { 214,  5,  8, 0,  0,  6},  // U
+  { 219,  5,  8, 0,  0,  6},  // V
+  { 224,  5,  8, 0,  0,  6},  // W
+  { 229,  5,  8, 0,  0,  6},  // X
+  { 234,  5,  8, 0,  0,  6},  // Y
+  { 239,  5,  8, 0,  0,  6},  // Z
+  { 244,  2, 10, 0,  0,  3},  // [
+  { 247,  3,  8, 0,  0,  4},  // backslash
+  { 250,  2, 10, 0,  0,  3},  // ]
+  { 253,  5,  4, 0,  0,  6},  // ^
+  { 256,  7,  1, 0,  9,  8},  // _
+  { 257,  2,  2, 0,  0,  3},  // `
+  { 258,  5,  6, 0,  2,  6},  // a
+  { 262,  5,  8, 0,  0,  6},  // b
+  { 267,  5,  6, 0,  2,  6},  // c
+  { 271,  5,  8, 0,  0,  6},  // d
+  { 276,  5,  6, 0,  2,  6},  // e
+  { 280,  5,  8, 0,  0,  6},  // f
+  { 285,  5,  8, 0,  2,  6},  // g
+  { 290,  5,  8, 0,  0,  6},  // h
+  { 295,  3,  8, 0,  0,  4},  // i
+  { 298,  4, 10, 0,  0,  5},  // j
+  { 303,  5,  8, 0,  0,  6},  // k
+  { 308,  3,  8, 0,  0,  4},  // l
+  { 311,  5,  6, 0,  2,  6},  // m
+  { 315,  5,  6, 0,  2,  6},  // n
+  { 319,  5,  6, 0,  2,  6},  // o
+  { 323,  5,  8, 0,  2,  6},  // p
+  { 328,  5,  8, 0,  2,  6},  // q
+  { 333,  5,  6, 0,  2,  6},  // r
+  { 337,  5,  6, 0,  2,  6},  // s
+  { 341,  4,  8, 0,  0,  5},  // t
+  { 345,  5,  6, 0,  2,  6},  // u
+  { 349,  5,  6, 0,  2,  6},  // v
+  { 353,  5,  6, 0,  2,  6},  // w
+  { 357,  5,  6, 0,  2,  6},  // x
+  { 361,  5,  8, 0,  2,  6},  // y
+  { 366,  5,  6, 0,  2,  6},  // z
+  { 370,  3, 10, 0,  0,  4},  // {
+  { 374,  1, 10, 0,  0,  2},  // |
+  { 376,  3, 10, 0,  0,  4},  // }
+  { 380,  5,  2, 0,  3,  6},  // ~
+  { 382,  4,  4, 0,  0,  5},  // U+00B0
+  { 384,  5,  8, 0,  2,  6},  // U+00B5
+};
+
+static const FontRange Font7x10P_Ranges [] = {
+  {0x0020,  95,   0},
+  {0x00B0,   1,  95},
+  {0x00B5,   1,  96},
+};
+
+// 97 glyphs: 389 bytes of bits + 776 bytes of glyphs + 24 bytes of ranges
+static const FontPacked Font7x10P_Packed = {3, Font7x10P_Ranges, Font7x10P_Glyphs, Font7x10P_Bits};
+
+static const uint8_t Font11x18P_Bits [] = {
+  // sp
+0xFF,0xF7,0xFF,0x0D,  // !
+0xFF,0x83,0xFF,0x01,  // "
+0x30,0x03,0xEC,0xFF,0xFF,0xFF,0x0D,0x30,0x03,0xEC,0xFF,0xFF,0xFF,0x0D,0x30,0x03,  // #
+0x1C,0x0E,0x3E,0x1E,0x77,0x38,0x63,0x30,0xFF,0xFF,0xC3,0x30,0x8E,0x1F,0x0C,0x0F,  // $
+0x1E,0xC0,0x0F,0x13,0x62,0xFC,0x0C,0x9E,0x01,0xB0,0x07,0xF6,0xC3,0x84,0x18,0x3F,0x83,0x07,  // %
+0x00,0x8F,0xE7,0xF7,0x0B,0x8F,0xC3,0xE3,0xF1,0xCF,0xE6,0xE1,0x00,0xFE,0x80,0x11,  // &
+0xFF,0x03,  // '
+0xC0,0x0F,0xE0,0xFF,0xC1,0x01,0x8E,0x01,0x60,0x01,0x00,0x02,  // (
+0x01,0x00,0x1A,0x00,0xC6,0x01,0x0E,0xFE,0x1F,0xC0,0x0F,0x00,  // )
+0x96,0xBF,0xC7,0x2D,  // *
+0x30,0xC0,0x00,0x03,0x0C,0xFF,0xFF,0x0F,0x03,0x0C,0x30,0xC0,0x00,  // +
+0xF3,0x01,  // ,
+0xFF,  // -
+0x0F,  // .
+0x00,0x38,0xE0,0x8F,0x7F,0xFC,0x01,0x07,0x00,  // /
+0xF8,0x87,0xFF,0x77,0x80,0x0F,0xC3,0xC3,0xF0,0x01,0xEE,0xFF,0xE1,0x1F,  // 0
+0x18,0x00,0x03,0x60,0x00,0xFC,0xFF,0xFF,0x3F,  // 1
+0x1C,0xB8,0x07,0x7F,0x60,0x0F,0xCC,0x83,0xF1,0x31,0xEC,0x07,0xF3,0xC0,  // 2
+0x0C,0x8C,0x03,0x37,0x80,0x8F,0xC1,0x63,0xB0,0x3F,0xCE,0xF9,0x01,0x3C,  // 3
+0x00,0x07,0xF0,0x81,0x6F,0x78,0x18,0xFF,0xFF,0xFF,0x0F,0x60,0x00,0x18,  // 4
+0xFF,0xCC,0x3F,0x37,0x84,0x8F,0xC1,0x63,0xF0,0x38,0x3E,0xFC,0x01,0x3E,  // 5
+0xF8,0x87,0xFF,0x77,0x8C,0x8F,0xC1,0x63,0xF0,0x39,0xEE,0xFC,0x31,0x3E,  // 6
+0x03,0xC0,0x00,0x30,0x80,0x0F,0xFE,0xE3,0xC3,0x1E,0xF0,0x01,0x1C,0x00,  // 7
+0x1C,0x8F,0xEF,0x37,0x0C,0x0F,0xC3,0xC3,0xF0,0x31,0xEC,0xFB,0x71,0x3C,  // 8
+0x7C,0x8C,0x3F,0x77,0x9C,0x0F,0xC6,0x83,0xF1,0x31,0xEE,0xFF,0xE1,0x1F,  // 9
+0x03,0x0F,0x0C,  // :
+0x83,0x39,0x78,  // ;
+0x10,0x70,0xA0,0x60,0x43,0xC4,0x98,0xA0,0xC1,  // <
+0xF3,0x3C,0xCF,0xF3,0x3C,0xCF,  // =
+0x83,0x05,0x19,0x23,0xC2,0x06,0x05,0x0E,0x08,  // >
+0x0C,0x80,0x03,0x70,0x00,0x0C,0xDC,0x83,0xF7,0x70,0x70,0x0E,0xF8,0x01,0x3C,0x00,  // ?
+0xF8,0x87,0xFF,0xF7,0x80,0x8F,0xC7,0xE3,0xF3,0xCC,0xE6,0x3F,0xF0,0x0F,  // @
+0x00,0x38,0xF0,0xCF,0x7F,0xFC,0x0C,0x03,0xC3,0xCF,0xC0,0x7F,0x00,0xFF,0x00,0x38,  // A
+0xFF,0xFF,0xFF,0x3F,0x0C,0x0F,0xC3,0xC3,0xB0,0x7F,0xCE,0xF3,0x01,0x38,  // B
+0xF8,0x87,0xFF,0x77,0x80,0x0F,0xC0,0x03,0xF0,0x00,0xEC,0xC0,0x31,0x30,  // C
+0xFF,0xFF,0xFF,0x3F,0x00,0x0F,0xC0,0x03,0xB0,0x03,0xE7,0xFF,0xE0,0x0F,  // D
+0xFF,0xFF,0xFF,0x3F,0x0C,0x0F,0xC3,0xC3,0xF0,0x30,0x3C,0x0C,0x0F,0xC0,  // E
+0xFF,0xFF,0xFF,0x3F,0x0C,0x0C,0x03,0xC3,0xC0,0x30,0x30,0x0C,0x0C,0x00,  // F
+0xF8,0x87,0xFF,0x77,0x80,0x0F,0xC0,0x03,0xF0,0x60,0xEC,0xF8,0x31,0x7E,  // G
+0xFF,0xFF,0xFF,0x0F,0x0C,0x00,0x03,0xC0,0x00,0x30,0xF0,0xFF,0xFF,0xFF,  // H
+0x03,0xF0,0x00,0xFC,0xFF,0xFF,0xFF,0x03,0xF0,0x00,0x0C,  // I
+0x00,0x0E,0x80,0x07,0x80,0x03,0xC0,0x00,0x30,0x00,0xFE,0xFF,0xFD,0x3F,  // J
+0xFF,0xFF,0xFF,0x0F,0x0C,0x80,0x03,0xB8,0x03,0xC7,0x61,0xC0,0x0D,0xE0,0x01,0x20,  // K
+0xFF,0xFF,0xFF,0x0F,0x00,0x03,0xC0,0x00,0x30,0x00,0x0C,0x00,0x03,0xC0,  // L
+0xFF,0xFF,0xFF,0xFF,0x00,0xF0,0x01,0xC0,0x00,0x1F,0x70,0x00,0xFC,0xFF,0xFF,0x3F,  // M
+0xFF,0xFF,0xFF,0xFF,0x01,0xF0,0x03,0xE0,0x0F,0x80,0xFF,0xFF,0xFF,0xFF,  // N
+0xF8,0x87,0xFF,0x77,0x80,0x0F,0xC0,0x03,0xF0,0x01,0xEE,0xFF,0xE1,0x1F,  // O
+0xFF,0xFF,0xFF,0x3F,0x18,0x0C,0x06,0x83,0xC1,0x71,0xE0,0x0F,0xF0,0x01,  // P
+0xF8,0x87,0xFF,0x77,0x80,0x0F,0xC0,0x03,0xF6,0x01,0xEF,0xFF,0xE1,0x5F,0x00,0x20,  // Q
+0xFF,0xFF,0xFF,0x3F,0x0C,0x0C,0x03,0xC3,0xC1,0xF9,0xE1,0xE7,0xF1,0xE0,0x00,0x20,  // R
+0x00,0x06,0x8F,0xE7,0x87,0x8F,0xC1,0xC3,0xF0,0x70,0xEC,0xF8,0x31,0x3C,  // S
+0x03,0xC0,0x00,0x30,0x00,0x0C,0x00,0xFF,0xFF,0xFF,0x3F,0x00,0x0C,0x00,0x03,0xC0,0x00,0x00,  // T
+0xFF,0xCF,0xFF,0x07,0x80,0x03,0xC0,0x00,0x30,0x00,0xFE,0xFF,0xFD,0x3F,  // U
+0x07,0xC0,0x0F,0x80,0x3F,0x00,0x7F,0x00,0x3C,0xF0,0x87,0x3F,0xFC,0x00,0x07,0x00,  // V
+0x3F,0xC0,0xFF,0x0F,0x80,0x03,0x3C,0xE0,0x01,0x78,0x00,0xF0,0x00,0xE0,0xFF,0xFF,0x0F,0x00,  // W
+0x01,0xE0,0x01,0xEE,0xC1,0xE1,0x3C,0xF0,0x07,0xF8,0x80,0x73,0x70,0x78,0x07,0x78,0x00,0x08,  // X
+0x01,0xC0,0x01,0xE0,0x01,0xE0,0x01,0xE0,0x3F,0xF8,0x8F,0x07,0x78,0x00,0x07,0x40,0x00,0x00,  // Y
+0x00,0xF8,0x00,0x3F,0x70,0x0F,0xCF,0xE3,0xF0,0x0E,0xFC,0x01,0x1F,0xC0,  // Z
+0xFF,0xFF,0xFF,0xFF,0x3F,0x00,0xF0,0x00,0xC0,  // [
+0x07,0xC0,0x1F,0x80,0x7F,0x00,0xFE,0x00,0x38,  // backslash
+0x03,0x00,0x0F,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,  // ]
+0xC0,0xF0,0x3C,0x07,0x07,0x3C,0xF0,0xC0,  // ^
+0xFF,0x07,  // _
+0xD9,0x09,  // `
+0xC4,0x99,0x3F,0xF3,0xCC,0x33,0xCD,0xF6,0x9F,0xFF,0x00,0x02,  // a
+0xFF,0xFF,0xFF,0x0F,0x86,0xC1,0xC0,0x30,0x30,0x1C,0x0E,0xFE,0x01,0x3F,  // b
+0xFC,0xF8,0x77,0xF8,0xC0,0x03,0x1F,0xEE,0x1C,0x33,  // c
+0xC0,0x0F,0xF8,0x07,0x87,0xC3,0xC0,0x30,0x30,0x18,0xF6,0xFF,0xFF,0xFF,  // d
+0xFC,0xF8,0x77,0xFB,0xCC,0x33,0xDF,0xEC,0x1B,0x2E,  // e
+0x30,0x00,0x0C,0x00,0x03,0xF8,0xFF,0xFF,0xFF,0x0C,0x30,0x03,0xCC,0x00,0x03,0x00,  // f
+0xFC,0x98,0x7F,0x7E,0x38,0x0F,0xCC,0x03,0xB3,0x61,0xFE,0xFF,0xFD,0x3F,  // g
+0xFF,0xFF,0xFF,0x0F,0x06,0xC0,0x00,0x30,0x00,0x0C,0x00,0xFF,0x83,0xFF,  // h
+0x30,0x00,0x0C,0x00,0x03,0xCC,0xFF,0xF3,0x3F,  // i
+0x00,0x80,0xC1,0x00,0x0C,0x03,0x30,0x0C,0xC0,0xF3,0xFF,0xCF,0xFF,0x07,  // j
+0xFF,0xFF,0xFF,0x0F,0x30,0x00,0x06,0xC0,0x03,0x98,0x03,0xC3,0x41,0xC0,0x00,0x20,  // k
+0x03,0xC0,0x00,0x30,0x00,0xFC,0xFF,0xFF,0x3F,  // l
+0xFF,0xFF,0x2F,0xC0,0x00,0xFF,0xFF,0x6F,0xC0,0x00,0xFF,0xFB,0x0F,  // m
+0xFF,0xFF,0x6F,0xC0,0x00,0x03,0x0C,0xF0,0xBF,0xFF,  // n
+0xFC,0xF8,0x77,0xF8,0xC0,0x03,0x1F,0xEE,0x1F,0x3F,  // o
+0xFF,0xFF,0xFF,0x6F,0x18,0x0C,0x0C,0x03,0xC3,0xE1,0xE0,0x1F,0xF0,0x03,  // p
+0xFC,0x80,0x7F,0x70,0x38,0x0C,0x0C,0x03,0x83,0x61,0xF0,0xFF,0xFF,0xFF,  // q
+0x01,0xFC,0xEF,0xBF,0x01,0x03,0x0C,0x70,0x80,0x00,  // r
+0x9C,0xF9,0x36,0xF3,0xCC,0x33,0xCF,0x6C,0x9F,0x39,  // s
+0x18,0x00,0x03,0xF8,0xBF,0xFF,0x8F,0x81,0x31,0x30,0x06,0x06,0xC0,  // t
+0xFF,0xFD,0x0F,0x30,0xC0,0x00,0x03,0xF6,0xFF,0xFF,  // u
+0x01,0x3C,0xE0,0x07,0x7C,0x80,0xC3,0xEF,0xC7,0x03,0x01,0x00,  // v
+0x07,0xFC,0x03,0xFC,0x3F,0x07,0xFC,0x03,0xFC,0x3F,0x07,0x00,  // w
+0x01,0x1E,0xEE,0x1C,0x1E,0x78,0x38,0x77,0x78,0x80,  // x
+0x03,0xF0,0x07,0xCC,0x8F,0x83,0x7F,0x00,0x1F,0xFE,0xF1,0x0F,0x1C,0x00,  // y
+0x03,0x0F,0x3E,0xFC,0xD8,0x33,0x6F,0xFC,0xF0,0xC1,0x03,0x03,  // z
+0x00,0x03,0x00,0x1E,0xE0,0xFF,0xDF,0x3F,0xFF,0x03,0x00,0x0F,0x00,0x0C,  // {
+0xFF,0xFF,0xFF,0xFF,0x0F,  // |
+0x03,0x00,0x0F,0x00,0xFC,0xCF,0xBF,0xFF,0x7F,0x80,0x07,0x00,0x0C,0x00,  // }
+0xDE,0x66,0x7B,  // ~
+0x8C,0x37,0xCF,0x1E,0x03,  // U+00B0
+0xFF,0xFF,0xFF,0x03,0x0C,0x80,0x01,0x30,0x00,0xC3,0xFF,0xF8,0x1F,  // U+00B5
+};
+
+static const FontGlyph Font11x18P_Glyphs [] = {
+  {   0,  0,  0, 0,  0,  5},  // sp
+  {   0,  2, 14, 0,  1,  3},  // !
+  {   4,  5,  5, 0,  1,  6},  // "
+  {   8,  9, 14, 0,  1, 10},  // #
+  {  24,  8, 16, 0,  1,  9},  // $
+  {  40, 10, 14, 0,  1, 11},  // %
+  {  58,  9, 14, 0,  1, 10},  // &
+  {  74,  2,  5, 0,  1,  3},  // '
+  {  76,  5, 18, 0,  0,  6},  // (
+  {  88,  5, 18, 0,  0,  6},  // )
+  { 100,  6,  5, 0,  1,  7},  // *
+  { 104, 10, 10, 0,  3, 11},  // +
+  { 117,  2,  5, 0, 13,  3},  // ,
+  { 119,  4,  2, 0,  9,  5},  // -
+  { 120,  2,  2, 0, 13,  3},  // .
+  { 121,  5, 14, 0,  1,  6},  // /
+  { 130,  8, 14, 0,  1,  9},  // 0
+  { 144,  5, 14, 0,  1,  6},  // 1
+  { 153,  8, 14, 0,  1,  9},  // 2
+  { 167,  8, 14, 0,  1,  9},  // 3
+  { 181,  8, 14, 0,  1,  9},  // 4
+  { 195,  8, 14, 0,  1,  9},  // 5
+  { 209,  8, 14, 0,  1,  9},  // 6
+  { 223,  8, 14, 0,  1,  9},  // 7
+  { 237,  8, 14, 0,  1,  9},  // 8
+  { 251,  8, 14, 0,  1,  9},  // 9
+  { 265,  2, 10, 0,  5,  3},  // :
+  { 268,  2, 12, 0,  6,  3},  // ;
+  { 271,  8,  9, 0,  4,  9},  // <
+  { 280,  8,  6, 0,  5,  9},  // =
+  { 286,  8,  9, 0,  4,  9},  // >
+  { 295,  9, 14, 0,  1, 10},  // ?
+  { 311,  8, 14, 0,  1,  9},  // @
+  { 325,  9, 14, 0,  1, 10},  // A
+  { 341,  8, 14, 0,  1,  9},  // B
+  { 355,  8, 14, 0,  1,  9},  // C
+  { 369,  8, 14, 0,  1,  9},  // D
+  { 383,  8, 14, 0,  1,  9},  // E
+  { 397,  8, 14, 0,  1,  9},  // F
+  { 411,  8, 14, 0,  1,  9},  // G
+  { 425,  8, 14, 0,  1,  9},  // H
+  { 439,  6, 14, 0,  1,  7},  // I
+  { 450,  8, 14, 0,  1,  9},  // J
+  { 464,  9, 14, 0,  1, 10},  // K
+  { 480,  8, 14, 0,  1,  9},  // L
+  { 494,  9, 14, 0,  1, 10},  // M
+  { 510,  8, 14, 0,  1,  9},  // N
+  { 524,  8, 14, 0,  1,  9},  // O
+  { 538,  8, 14, 0,  1,  9},  // P
+  { 552,  9, 14, 0,  1, 10},  // Q
+  { 568,  9, 14, 0,  1, 10},  // R
+  { 584,  8, 14, 0,  1,  9},  // S
+  { 598, 10, 14, 0,  1, 11},  // T
+  { 616,  8, 14, 0,  1,  9},  // U
+  { 630,  9, 14, 0,  1, 10},  // V
+  { 646, 10, 14, 0,  1, 11},  // W
+  { 664, 10, 14, 0,  1, 11},  // X
+  { 682, 10, 14, 0,  1, 11},  // Y
+  { 700,  8, 14, 0,  1,  9},  // Z
+  { 714,  4, 18, 0,  0,  5},  // [
+  { 723,  5, 14, 0,  1,  6},  // backslash
+  { 732,  4, 18, 0,  0,  5},  // ]
+  { 741,  8,  8, 0,  1,  9},  // ^
+  { 749, 11,  1, 0, 16, 12},  // _
+  { 751,  4,  3, 0,  1,  5},  // `
+  { 753,  9, 10, 0,  5, 10},  // a
+  { 765,  8, 14, 0,  1,  9},  // b
+  { 779,  8, 10, 0,  5,  9},  // c
+  { 789,  8, 14, 0,  1,  9},  // d
+  { 803,  8, 10, 0,  5,  9},  // e
+  { 813,  9, 14, 0,  1, 10},  // f
+  { 829,  8, 14, 0,  4,  9},  // g
+  { 843,  8, 14, 0,  1,  9},  // h
+  { 857,  5, 14, 0,  1,  6},  // i
+  { 866,  6, 18, 0,  0,  7},  // j
+  { 880,  9, 14, 0,  1, 10},  // k
+  { 896,  5, 14, 0,  1,  6},  // l
+  { 905, 10, 10, 0,  5, 11},  // m
+  { 918,  8, 10, 0,  5,  9},  // n
+  { 928,  8, 10, 0,  5,  9},  // o
+  { 938,  8, 14, 0,  4,  9},  // p
+  { 952,  8, 14, 0,  4,  9},  // q
+  { 966,  8, 10, 0,  5,  9},  // r
+  { 976,  8, 10, 0,  5,  9},  // s
+  { 986,  8, 13, 0,  2,  9},  // t
+  { 999,  8, 10, 0,  5,  9},  // u
+  {1009,  9, 10, 0,  5, 10},  // v
+  {1021,  9, 10, 0,  5, 10},  // w
+  {1033,  8, 10, 0,  5,  9},  // x
+  {1043,  8, 14, 0,  4,  9},  // y
+  {1057,  9, 10, 0,  5, 10},  // z
+  {1069,  6, 18, 0,  0,  7},  // {
+  {1083,  2, 18, 0,  0,  3},  // |
+  {1088,  6, 18, 0,  0,  7},  // }
+  {1102,  8,  3, 0,  7,  9},  // ~
+  {1105,  6,  6, 0,  1,  7},  // U+00B0
+  {1110,  8, 13, 0,  5,  9},  // U+00B5
+};
+
+static const FontRange Font11x18P_Ranges [] = {
+  {0x0020,  95,   0},
+  {0x00B0,   1,  95},
+  {0x00B5,   1,  96},
+};
+
+// 97 glyphs: 1123 bytes of bits + 776 bytes of glyphs + 24 bytes of ranges
+static const FontPacked Font11x18P_Packed = {3, Font11x18P_Ranges, Font11x18P_Glyphs, Font11x18P_Bits};
+
+static const uint8_t Font16x26P_Bits [] = {
+  // sp
+0xFF,0x03,0xFC,0xFF,0x8F,0xFF,0xFF,0xF1,0xFF,0x3F,0xFE,0x0F,0xC0,0x01,  // !
+0xFF,0xFF,0xFF,0x0F,0x00,0x00,0xFE,0xFF,0xFF,0x1F,  // "
+0x00,0x60,0x00,0x10,0x0C,0x00,0x83,0x71,0x60,0xF0,0x0F,0xEC,0xFF,0xC1,0xFF,0x9F,0xFF,0x3F,0xF8,0x7F,0xC3,0xFF,0xE0,0xFF,0x98,0xFF,0x03,0xFF,0x7F,0xFE,0xFF,0xF0,0xFF,0x07,0xFE,0xC1,0xC0,0x33,0x18,0x00,0x06,0x03,  // #
+0x00,0x00,0x0C,0x7E,0x00,0x86,0x7F,0x00,0xC7,0x7F,0x80,0xF3,0x7F,0x80,0x39,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x01,0xFE,0xCF,0x01,0xFE,0xE3,0x00,0xFF,0x61,0x00,0x7F,0x00,  // $
+0xFE,0x01,0xD8,0x3F,0x80,0xFF,0x0F,0xFC,0x81,0xC1,0x17,0x20,0x7C,0x9E,0xE7,0xC3,0xFF,0x3E,0xF0,0xFF,0x03,0xFC,0xFF,0x07,0xF0,0xFF,0x81,0xEF,0x7F,0xF8,0xFC,0xCF,0x8F,0x81,0x7D,0x30,0xF0,0x07,0xFE,0x3F,0xC0,0xFF,  // %
+0x00,0xF8,0x03,0x80,0xFF,0x00,0xF0,0x3F,0x1C,0xFF,0xEF,0xFF,0xE0,0xFF,0x0F,0xF8,0xFF,0x07,0xFE,0xFF,0xC1,0x83,0xFF,0xF8,0xBF,0xBF,0xFF,0xC7,0x7F,0x7F,0xF0,0xE7,0x07,0xF8,0x01,0xE0,0x3F,0x00,0xFF,0x07,0xE0,0xEF,  // &
+0xBF,0xFF,0xFF,0xFF,0x01,  // '
+0x00,0xFF,0x00,0xC0,0xFF,0x0F,0xC0,0xFF,0x3F,0xE0,0xFF,0xFF,0xC1,0x1F,0xF8,0xC3,0x07,0x80,0xCF,0x03,0x00,0xBC,0x03,0x00,0x70,0x03,0x00,0xC0,0x07,0x00,0x80,0x07,0x00,0x00,0x0E,0x00,0x00,0x0C,  // (
+0x01,0x00,0x80,0x03,0x00,0x00,0x0F,0x00,0x00,0x1F,0x00,0x00,0x7E,0x00,0x00,0xEE,0x01,0x00,0x9E,0x0F,0x00,0x1F,0xFE,0xC0,0x1F,0xFC,0xFF,0x3F,0xE0,0xFF,0x1F,0x80,0xFF,0x1F,0x00,0xF8,0x07,0x00,  // )
+0x38,0x80,0x43,0x38,0x06,0xF3,0xF3,0xFF,0x7F,0x1F,0xF1,0x3B,0xF1,0x0F,0xFB,0x38,0x8F,0x43,0x38,0x00,0x03,  // *
+0x80,0x01,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0xFE,0xFF,0xFF,0xFF,0xFF,0x3F,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00,0x06,0x00,0x03,  // +
+0x0F,0xFF,0xFF,0xFF,0xF7,0x07,  // ,
+0xFF,0xFF,0xFF,0x03,  // -
+0xFF,0xFF,0x0F,  // .
+0x00,0x00,0x00,0x01,0x00,0x80,0x03,0x00,0xC0,0x07,0x00,0xE0,0x0F,0x00,0xF0,0x0F,0x00,0xF8,0x07,0x00,0xFC,0x03,0x00,0xFE,0x01,0x00,0xFF,0x00,0x80,0x7F,0x00,0xC0,0x3F,0x00,0xE0,0x1F,0x00,0xF0,0x0F,0x00,0xE0,0x07,0x00,0xC0,0x03,0x00,0x80,0x01,0x00,0x00,  // /
+0xE0,0xFF,0x00,0xFF,0x7F,0xF0,0xFF,0x1F,0xFF,0xFF,0xF7,0x07,0xFC,0x1F,0x00,0xFC,0x01,0x00,0x1F,0x00,0xC0,0x07,0x00,0xFC,0x01,0xC0,0xFF,0x01,0x7F,0xFF,0xFF,0xC7,0xFF,0x7F,0xF0,0xFF,0x07,0xF8,0x3F,0x00,  // 0
+0x0C,0x00,0x98,0x01,0x00,0x33,0x00,0x60,0x07,0x00,0xEC,0x00,0x80,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0x60,0x00,0x00,0x0C,0x00,0x80,0x01,0x00,0x30,  // 1
+0x06,0x00,0xDE,0x00,0xE0,0x1F,0x00,0xFE,0x03,0xF0,0x3F,0x00,0xBF,0x07,0xF0,0xF1,0x00,0x1F,0x3E,0xF0,0xC1,0xFF,0x1F,0xD8,0xFF,0x01,0xFB,0x1F,0x60,0xFE,0x01,0x0C,0x07,0x80,0x01,  // 2
+0x06,0x00,0xFC,0xC0,0x80,0x1F,0x18,0xF0,0x01,0x03,0x3C,0x60,0x80,0x07,0x0E,0xF0,0xC1,0x03,0xFF,0xFF,0xF0,0xFF,0xFF,0xCF,0xBF,0xFF,0xF1,0xE3,0x1F,0x1C,0xF8,0x01,  // 3
+0x00,0x60,0x00,0x00,0x0F,0x00,0xF0,0x01,0x80,0x3F,0x00,0xF8,0x07,0xC0,0xCF,0x00,0xFC,0x18,0xC0,0x07,0x03,0x7E,0x60,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x01,0xC0,0x00,0x00,0x18,0x00,0x00,0x03,  // 4
+0xFF,0x03,0xFC,0x7F,0x80,0xFF,0x0F,0xF0,0xFF,0x01,0x7C,0x30,0x80,0x0F,0x0E,0xF0,0xC1,0x03,0x3F,0xF8,0xFD,0x07,0xFE,0xEF,0xC0,0xFF,0x1D,0xF0,0x1F,0x00,0xF8,0x00,  // 5
+0x00,0x0C,0x00,0xFC,0x3F,0xE0,0xFF,0x1F,0xFE,0xFF,0xE7,0xFF,0xFF,0x7C,0x1C,0xFE,0xC3,0x01,0x3F,0x18,0xC0,0x03,0x03,0x78,0xE0,0x80,0x0F,0x3C,0xF8,0x83,0xFF,0x77,0xE0,0xFF,0x0C,0xF8,0x0F,0x00,0xFE,0x00,  // 6
+0x07,0x00,0xE0,0x00,0x00,0x1F,0x00,0xFC,0x03,0xC0,0x7F,0x00,0xFE,0x0F,0xF0,0xFF,0x81,0xFF,0x38,0xF8,0x03,0xC7,0x1F,0xE0,0xFE,0x00,0xFC,0x07,0x80,0x3F,0x00,0xF0,0x03,0x00,0x1E,0x00,0x00,  // 7
+0x00,0xC0,0x01,0x06,0xFE,0xF0,0xE3,0x3F,0xFF,0xFE,0xF7,0xFF,0xFF,0xFF,0x3F,0xF8,0xE1,0x01,0x1F,0x78,0xC0,0x03,0x0F,0xF8,0xF0,0x83,0xFF,0xFF,0xF9,0xFF,0xFE,0xE7,0x8F,0xFF,0xF8,0xE0,0x0F,0x00,0xF8,0x00,  // 8
+0xE0,0x01,0x00,0xFF,0x80,0xF1,0x3F,0x70,0xFF,0x07,0xFE,0xFF,0x81,0x0F,0x38,0xF0,0x00,0x06,0x1E,0xC0,0xE0,0x07,0x18,0xFC,0x81,0xE3,0xFF,0xBF,0x3F,0xFF,0xFF,0xC3,0xFF,0x3F,0xF0,0xFF,0x03,0xF8,0x0F,0x00,  // 9
+0x0F,0xF8,0x07,0xFC,0x03,0xFE,0x01,0xFF,0x80,0x07,  // :
+0x0F,0x78,0xFC,0x80,0xFF,0x0F,0xF8,0xFF,0x80,0x7F,0x0F,0xF8,0x03,  // ;
+0x80,0x00,0x40,0x00,0x70,0x00,0x38,0x00,0x3E,0x00,0x1F,0xC0,0x1F,0xE0,0x0E,0x38,0x0E,0x1C,0x07,0x07,0x87,0x83,0xE3,0x80,0x73,0xC0,0x1D,0xC0,0x0F,0xE0,  // <
+0xE3,0xF1,0x78,0x3C,0x1E,0x8F,0xC7,0xE3,0xF1,0x78,0x3C,0x1E,0x8F,0xC7,  // =
+0x03,0xE0,0x03,0xF8,0x01,0xDC,0x01,0xE7,0x80,0xE3,0xE0,0x70,0x70,0x70,0x1C,0x38,0x0E,0xB8,0x03,0xDC,0x01,0x7C,0x00,0x3E,0x00,0x0E,0x00,0x07,0x00,0x01,  // >
+0x1E,0x00,0xE0,0x03,0x00,0x7C,0x00,0x80,0x01,0x30,0x3E,0x80,0xC7,0x07,0xF8,0xF8,0x80,0x1F,0x1F,0xF8,0xE3,0x87,0x07,0xE0,0x7F,0x00,0xF8,0x07,0x00,0x7F,0x00,0xC0,0x07,0x00,0x30,0x00,0x00,  // ?
+0x00,0x3F,0x00,0xFC,0x3F,0xE0,0xFF,0x0F,0xFE,0xFF,0xE3,0x07,0xF8,0x3C,0x00,0xDC,0xE3,0x3F,0x3F,0xFE,0xEF,0xE3,0xFF,0x79,0x3E,0x38,0xCF,0x01,0xE7,0x1B,0xF8,0xFE,0xE7,0xCF,0xFD,0xFF,0x9B,0xFF,0x7F,0xC0,0xFF,0x0F,  // @
+0x00,0x80,0x03,0x80,0x0F,0xC0,0x3F,0xC0,0xFF,0xE0,0x7F,0xF0,0x7F,0xF0,0xBF,0xC1,0x1F,0x06,0x1F,0x18,0xFC,0x63,0xF0,0xFF,0x01,0xFF,0x0F,0xE0,0xFF,0x00,0xFE,0x0F,0xC0,0x3F,0x00,0xFC,  // A
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x03,0x0F,0x0C,0x3C,0x30,0xF0,0xE0,0xC1,0xC7,0x07,0xFF,0x7F,0xFE,0xEF,0xBF,0x3F,0x7F,0x7C,0xFC,0x01,0xE0,0x03,  // B
+0xE0,0x1F,0xE0,0xFF,0xC1,0xFF,0x0F,0xFF,0x3F,0x3E,0xF8,0x39,0x80,0x77,0x00,0xFC,0x01,0xE0,0x03,0x00,0x0F,0x00,0x3C,0x00,0xF0,0x00,0xC0,0x07,0x00,0x1F,0x00,0x7E,0x00,0x38,  // C
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0x0F,0x00,0x3C,0x00,0xF0,0x00,0xC0,0x07,0x80,0x1F,0x00,0xFE,0x01,0x9E,0xFF,0x7F,0xFE,0xFF,0xF0,0xFF,0x83,0xFF,0x03,  // D
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0C,0x3C,0x30,0xF0,0xC0,0xC0,0x03,0x03,0x0F,0x0C,0x3C,0x30,0xF0,0xC0,0xC0,0x03,0x03,0x0F,0x00,0x0C,  // E
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xC0,0x00,0x03,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xC0,0x00,0x03,0x03,0x00,  // F
+0x80,0x07,0xC0,0xFF,0x80,0xFF,0x07,0xFF,0x3F,0xFE,0xFF,0xF9,0xC0,0xF7,0x00,0xFC,0x01,0xE0,0x07,0x80,0x0F,0x18,0x3C,0x60,0xF0,0x80,0xC1,0x03,0xFE,0x1F,0xF8,0x7F,0xE0,0xBF,0x81,0x7F,  // G
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,  // H
+0x03,0x00,0x0F,0x00,0x3C,0x00,0xF0,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0x3C,0x00,0xF0,0x00,0xC0,0x03,0x00,0x0F,0x00,0x0C,  // I
+0x00,0x80,0x0F,0x00,0x3E,0x00,0xF8,0x00,0xC0,0x03,0x00,0x0F,0x00,0x3C,0x00,0xF8,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xF7,0xFF,0xCF,0xFF,0x07,  // J
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x07,0x80,0x3F,0x00,0xFF,0x01,0xBE,0x1F,0x7C,0xFC,0x7C,0xE0,0xF7,0x00,0xFE,0x01,0xF0,0x03,0x80,0x07,0x00,0x0C,  // K
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,  // L
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x01,0xF8,0x1F,0x80,0xFF,0x03,0xF0,0x0F,0x00,0x3E,0x00,0xFF,0x80,0xFF,0xC1,0xFF,0x00,0x7F,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,  // M
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0xF0,0x07,0x80,0x7F,0x00,0xF8,0x07,0x80,0x3F,0x00,0xFC,0x03,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,  // N
+0xC0,0x0F,0xE0,0xFF,0xC1,0xFF,0x8F,0xFF,0x7F,0xFE,0xFF,0x3D,0x00,0x7F,0x00,0xF8,0x00,0xC0,0x03,0x00,0x0F,0x00,0x7C,0x00,0xF8,0x03,0xF0,0xFE,0xFF,0xF9,0xFF,0xC7,0xFF,0x0F,0xFE,0x1F,  // O
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x18,0x30,0x60,0xC0,0x80,0x01,0x03,0x07,0x1C,0x1E,0xF0,0x3F,0xC0,0xFF,0x00,0xFE,0x01,0xF8,0x07,0x00,  // P
+0xC0,0x0F,0x00,0xFE,0x1F,0xC0,0xFF,0x0F,0xF8,0xFF,0x07,0xFE,0xFF,0xC1,0x03,0xF0,0x70,0x00,0x38,0x0C,0x00,0x0C,0x03,0x00,0xC3,0x00,0xC0,0x71,0x00,0xF8,0x3C,0x00,0x3F,0xFE,0xFF,0x9F,0xFF,0x7F,0xC7,0xFF,0x8F,0xE3,0xFF,0xE1,  // Q
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0x06,0x0C,0x38,0x30,0xF0,0xC1,0xC1,0x0F,0xCF,0x7F,0xFC,0xEF,0xE7,0x1F,0xBF,0x7F,0xF8,0x7C,0xC0,0x03,0x00,0x0C,  // R
+0x7C,0xC0,0xF9,0x03,0xEE,0x1F,0xF8,0x7F,0xE0,0xC7,0x03,0x0F,0x0E,0x3C,0x38,0xF0,0xE0,0xC1,0x03,0x87,0x0F,0x3C,0x7F,0xF0,0xDF,0x81,0x7F,0x06,0xFE,0x00,0xF0,0x01,  // S
+0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0C,0x00,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x00,0x00,  // T
+0xFF,0x1F,0xFC,0xFF,0xF3,0xFF,0xDF,0xFF,0x7F,0xFF,0xFF,0x03,0x00,0x0E,0x00,0x30,0x00,0xC0,0x00,0x00,0x03,0x00,0x0E,0x00,0xFE,0xFF,0x7F,0xFF,0xFF,0xFD,0xFF,0xF3,0xFF,0x01,  // U
+0x07,0x00,0x7C,0x00,0xF0,0x0F,0xC0,0xFF,0x01,0xFC,0x1F,0xC0,0xFF,0x03,0xF8,0x3F,0x80,0xFF,0x00,0xF0,0x03,0xF0,0x0F,0xF0,0x3F,0xF8,0x3F,0xF8,0x1F,0xFC,0x0F,0xF0,0x0F,0xC0,0x07,0x00,  // V
+0x7F,0x00,0xFC,0xFF,0xF0,0xFF,0xBF,0xFF,0xFF,0x00,0xFF,0x03,0xF8,0x0F,0xFF,0x3F,0xFC,0x1F,0xF0,0x07,0xC0,0xFF,0x01,0xFF,0x3F,0xC0,0xFF,0x00,0xFC,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,  // W
+0x01,0x00,0x0E,0x00,0xFE,0x00,0xFC,0x07,0xF8,0x3F,0xF8,0xF9,0xF3,0xC1,0xFF,0x03,0xFC,0x07,0xE0,0x0F,0x80,0xFF,0x80,0xFF,0x07,0x1F,0x3F,0x3E,0xF8,0x7F,0xC0,0xFF,0x00,0xFC,0x00,0xE0,  // X
+0x01,0x00,0x1C,0x00,0xF0,0x01,0xC0,0x0F,0x00,0xFF,0x00,0xF0,0x07,0x00,0xFF,0x3F,0xF8,0xFF,0x80,0xFF,0x03,0xFF,0x0F,0xFE,0x3F,0x7E,0x00,0xFC,0x00,0xFC,0x00,0xF0,0x01,0xC0,0x01,0x00,  // Y
+0x03,0x80,0x0F,0x00,0x3F,0x00,0xFE,0x00,0xFE,0x03,0xFC,0x0F,0xF8,0x3D,0xF0,0xF1,0xF0,0xC3,0xE3,0x07,0xCF,0x0F,0xBC,0x0F,0xF0,0x1F,0xC0,0x3F,0x00,0x7F,0x00,0xFC,0x00,0x30,  // Z
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x06,  // [
+0x03,0x00,0x00,0x1E,0x00,0x00,0xFC,0x00,0x00,0xF8,0x07,0x00,0xC0,0x3F,0x00,0x00,0xFE,0x01,0x00,0xF0,0x0F,0x00,0x80,0x7F,0x00,0x00,0xFC,0x03,0x00,0xE0,0x1F,0x00,0x00,0xFF,0x00,0x00,0xF8,0x07,0x00,0xC0,0x1F,0x00,0x00,0x3E,0x00,0x00,0x70,  // backslash
+0x01,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,  // ]
+0x00,0x80,0x01,0xE0,0x03,0xF0,0x07,0xF8,0x0F,0xFE,0x03,0xFF,0x81,0xFF,0x80,0x3F,0x00,0xFF,0x01,0xF0,0x1F,0x80,0xFF,0x00,0xFC,0x07,0xC0,0x1F,0x00,0x3E,0x00,0x70,  // ^
+0xFF,0xFF,0xFF,0xFF,  // _
+0x0F,  // `
+0x00,0x1E,0x83,0x9F,0xE1,0xFF,0xF0,0x7F,0xBC,0x1F,0x0E,0x0F,0x83,0x87,0xC1,0xC7,0xF0,0xFF,0xDF,0xFF,0xEF,0xFF,0xEF,0xFF,0xC7,0xFF,0x03,0x80,0x01,  // a
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,0x38,0xC0,0x81,0x03,0x38,0x30,0x00,0x06,0x06,0xC0,0xC0,0x01,0x1C,0x78,0xE0,0x03,0xFF,0x3F,0xC0,0xFF,0x07,0xF8,0x7F,0x00,0xFC,0x03,  // b
+0xC0,0x01,0xFC,0x07,0xFF,0xC7,0xFF,0xE7,0xFF,0xFB,0xE0,0x1F,0xC0,0x0F,0xE0,0x03,0xE0,0x01,0xF0,0x00,0x78,0x00,0x7C,0x00,0x3F,0x80,0x1B,0xC0,0x00,  // c
+0x00,0xFC,0x01,0xE0,0xFF,0x00,0xFE,0x3F,0xC0,0xFF,0x0F,0xFC,0xF9,0x81,0x03,0x38,0x30,0x00,0x06,0x06,0xC0,0xC0,0x00,0x1C,0x38,0xC0,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,  // d
+0xE0,0x03,0xFC,0x07,0xFF,0xC7,0xFF,0xE7,0xFF,0x7B,0xC6,0x1F,0xC3,0x87,0xC1,0xC3,0xE0,0x63,0xF0,0x3F,0xF8,0x1F,0xEC,0x0F,0xE7,0x87,0xC3,0xC3,0x00,  // e
+0xC0,0x00,0x00,0x18,0x00,0x00,0x03,0x00,0x60,0x00,0x80,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0x18,0x00,0x04,0x03,0x80,0x60,0x00,0x10,0x0C,0x00,0x82,0x01,0xC0,0x30,0x00,0x00,  // f
+0xF0,0x07,0xC0,0xFF,0xC1,0xFE,0x3F,0xEC,0xFF,0xC7,0x3F,0x7E,0x78,0x00,0x87,0x03,0x60,0x38,0x00,0x86,0x07,0x70,0x7C,0x80,0xC3,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0x3F,0xFF,0x7F,0x00,  // g
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x78,0x00,0x80,0x07,0x00,0x70,0x00,0x00,0x06,0x00,0xC0,0x00,0x00,0xF8,0xFF,0x03,0xFF,0x7F,0xE0,0xFF,0x0F,0xF8,0xFF,0x01,0xFC,0x3F,  // h
+0xC0,0x00,0x00,0x18,0x00,0x00,0x03,0x00,0x60,0x00,0x00,0x0C,0x00,0x80,0x01,0xC0,0xF0,0xFF,0x1F,0xFE,0xFF,0xC3,0xFF,0x7F,0xF8,0xFF,0x0F,0x00,0x00,  // i
+0x00,0x00,0x00,0x03,0x03,0x00,0x0C,0x0C,0x00,0x30,0x30,0x00,0x80,0xC0,0x00,0x00,0x02,0x03,0x00,0x08,0x0C,0x00,0xF0,0xF0,0xFF,0xFF,0xC3,0xFF,0xFF,0x0F,0xFF,0xFF,0x3F,0xFC,0xFF,0xDF,0xF0,0xFF,0x1F,  // j
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0x07,0x00,0xF8,0x01,0x80,0x7F,0x00,0xF8,0x1F,0x80,0xCF,0x07,0xF8,0xF0,0x03,0x0F,0x7C,0xE0,0x00,0x0F,0x0C,0xC0,0x81,0x00,0x30,  // k
+0x01,0x00,0x20,0x00,0x00,0x04,0x00,0x80,0x00,0x00,0x10,0x00,0x00,0x02,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,  // l
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x03,0x78,0x00,0x7C,0x00,0xFE,0xFF,0xFF,0x7F,0xFF,0xBF,0x0F,0xE0,0x01,0xF0,0x00,0xF8,0xFF,0xFF,0xFF,0xFD,0xFF,  // m
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0x01,0x78,0x00,0x1C,0x00,0x06,0x00,0x03,0x80,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFF,0xC7,0xFF,0x03,  // n
+0xF0,0x07,0xFE,0x8F,0xFF,0xCF,0xFF,0xF7,0xC1,0x3F,0x80,0x0F,0x80,0x07,0xC0,0x03,0xE0,0x03,0xF8,0x07,0xDF,0xFF,0xE7,0xFF,0xE3,0xFF,0xE0,0x3F,0x00,  // o
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0E,0x78,0x70,0x00,0x07,0x03,0x60,0x30,0x00,0x06,0x07,0x70,0xF0,0xC0,0x07,0xFF,0x7F,0xE0,0xFF,0x03,0xFE,0x1F,0x80,0x7F,0x00,  // p
+0xF0,0x0F,0xC0,0xFF,0x01,0xFE,0x3F,0xE0,0xFF,0x07,0x1F,0x7C,0x70,0x00,0x07,0x03,0x60,0x30,0x00,0x06,0x07,0x70,0x70,0x80,0x03,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,  // q
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x00,0x3C,0x00,0x0E,0x00,0x03,0x80,0x01,0xC0,0x07,0xE0,0x03,0xF0,0x01,0x00,  // r
+0x38,0x30,0x3F,0xB8,0x1F,0xFC,0x1F,0xFE,0x0F,0x1E,0x07,0x0F,0x87,0x87,0xC3,0xC3,0xF3,0xC1,0xFF,0xE1,0xEF,0xF0,0x67,0xF0,0x01,  // s
+0x18,0x00,0x60,0x00,0x80,0x01,0x00,0x06,0x00,0xFF,0xFF,0xFC,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x18,0x80,0x63,0x00,0x8C,0x01,0x30,0x06,0xC0,0x18,0x00,0x63,0x00,0x8C,0x01,0x30,  // t
+0xFF,0x9F,0xFF,0xDF,0xFF,0xFF,0xFF,0x0F,0x00,0x07,0x00,0x03,0xC0,0x01,0xF0,0x00,0xBC,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,  // u
+0x01,0x80,0x03,0xC0,0x0F,0xE0,0x1F,0xE0,0x7F,0xC0,0xFF,0x80,0xFF,0x01,0xFE,0x00,0x7C,0x80,0x3F,0xF0,0x1F,0xFF,0xE3,0x3F,0xF8,0x07,0xFC,0x00,0x0E,0x00,  // v
+0x3F,0x80,0xFF,0xC3,0xFF,0xFF,0xFF,0x0F,0xFC,0x07,0xFE,0xF3,0xFF,0xFD,0x0F,0x7E,0x00,0xFF,0x83,0xFF,0x1F,0xFE,0x0F,0xF0,0xC7,0xFF,0xFF,0xFF,0xFF,0x0F,  // w
+0x01,0xC0,0x03,0xF8,0x03,0xFE,0x83,0xFF,0xF7,0xF3,0xFF,0xE0,0x1F,0xE0,0x0F,0xF0,0x0F,0xFE,0x8F,0xDF,0xFF,0xC3,0xFF,0x80,0x1F,0x80,0x07,0x80,0x01,  // x
+0x01,0x00,0x70,0x00,0x80,0x1F,0x00,0xF8,0x0F,0x80,0xFF,0x03,0xCC,0xFF,0xE0,0xE0,0xFF,0x0F,0xF8,0xFF,0x00,0xFE,0x07,0xF0,0x1F,0xE0,0x3F,0x80,0xFF,0x00,0xFE,0x03,0xF0,0x0F,0x00,0x1F,0x00,0x70,0x00,0x00,  // y
+0x00,0xE0,0x01,0xF8,0x00,0x7F,0xC0,0x3F,0xF0,0x1F,0x7C,0x0F,0x9F,0xC7,0xC7,0xF3,0xE1,0x7D,0xF0,0x1F,0xF8,0x07,0xFC,0x01,0x7E,0x00,0x1F,0x80,0x01,  // z
+0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0xE0,0xC3,0xC3,0xE7,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xF3,0xFF,0xC3,0x81,0xC3,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x18,  // {
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x07,  // |
+0x01,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x3C,0x18,0x18,0xFC,0xFF,0xFC,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0x7F,0x3E,0x3C,0x7C,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,  // }
+0xD8,0xFF,0x3F,0xC6,0x79,0xCE,0x73,0x8C,0xFF,0x7F,  // ~
+0x78,0xF0,0xE3,0xDF,0xE1,0x03,0x0F,0x7C,0xB8,0x7F,0xFC,0xE0,0x01,  // U+00B0
+0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x70,0x00,0x00,0x06,0x00,0x70,0x00,0x80,0x07,0x00,0x3C,0xF0,0xFF,0x07,0xFF,0x7F,0xF0,0xFF,0x07,0xFF,0x7F,0x00,  // U+00B5
+};
+
+static const FontGlyph Font16x26P_Glyphs [] = {
+  {   0,  0,  0, 0,  0,  8},  // sp
+  {   0,  5, 21, 0,  0,  6},  // !
+  {  14, 11,  7, 0,  0, 12},  // "
+  {  24, 16, 21, 0,  0, 17},  // #
+  {  66, 13, 23, 0,  0, 14},  // $
+  { 104, 16, 21, 0,  0, 17},  // %
+  { 146, 16, 21, 0,  0, 17},  // &
+  { 188,  5,  7, 0,  0,  6},  // '
+  { 193, 12, 25, 0,  0, 13},  // (
+  { 231, 12, 25, 0,  0, 13},  // )
+  { 269, 14, 12, 0,  0, 15},  // *
+  { 290, 16, 15, 0,  6, 17},  // +
+  { 320,  5,  9, 0, 17,  6},  // ,
+  { 326, 13,  2, 0, 11, 14},  // -
+  { 330,  5,  4, 0, 17,  6},  // .
+  { 333, 16, 25, 0,  0, 17},  // /
+  { 383, 15, 21, 0,  0, 16},  // 0
+  { 423, 14, 21, 0,  0, 15},  // 1
+  { 460, 13, 21, 0,  0, 14},  // 2
+  { 495, 12, 21, 0,  0, 13},  // 3
+  { 527, 16, 21, 0,  0, 17},  // 4
+  { 569, 12, 21, 0,  0, 13},  // 5
+  { 601, 15, 21, 0,  0, 16},  // 6
+  { 641, 14, 21, 0,  0, 15},  // 7
+  { 678, 15, 21, 0,  0, 16},  // 8
+  { 718, 15, 21, 0,  0, 16},  // 9
+  { 758,  5, 15, 0,  6,  6},  // :
+  { 768,  5, 20, 0,  6,  6},  // ;
+  { 781, 16, 15, 0,  6, 17},  // <
+  { 811, 16,  7, 0, 10, 17},  // =
+  { 825, 16, 15, 0,  6, 17},  // >
+  { 855, 14, 21, 0,  0, 15},  // ?
+  { 892, 16, 21, 0,  0, 17},  // @
+  { 934, 16, 18, 0,  3, 17},  // A
+  { 970, 14, 18, 0,  3, 15},  // B
+  {1002, 15, 18, 0,  3, 16},  // C
+  {1036, 15, 18, 0,  3, 16},  // D
+  {1070, 14, 18, 0,  3, 15},  // E
+  {1102, 13, 18, 0,  3, 14},  // F
+  {1132, 16, 18, 0,  3, 17},  // G
+  {1168, 15, 18, 0,  3, 16},  // H
+  {1202, 14, 18, 0,  3, 15},  // I
+  {1234, 12, 18, 0,  3, 13},  // J
+  {1261, 14, 18, 0,  3, 15},  // K
+  {1293, 14, 18, 0,  3, 15},  // L
+  {1325, 16, 18, 0,  3, 17},  // M
+  {1361, 15, 18, 0,  3, 16},  // N
+  {1395, 16, 18, 0,  3, 17},  // O
+  {1431, 14, 18, 0,  3, 15},  // P
+  {1463, 16, 22, 0,  3, 17},  // Q
+  {1507, 14, 18, 0,  3, 15},  // R
+  {1539, 14, 18, 0,  3, 15},  // S
+  {1571, 16, 18, 0,  3, 17},  // T
+  {1607, 15, 18, 0,  3, 16},  // U
+  {1641, 16, 18, 0,  3, 17},  // V
+  {1677, 16, 18, 0,  3, 17},  // W
+  {1713, 16, 18, 0,  3, 17},  // X
+  {1749, 16, 18, 0,  3, 17},  // Y
+  {1785, 15, 18, 0,  3, 16},  // Z
+  {1819, 11, 25, 0,  0, 12},  // [
+  {1854, 15, 25, 0,  0, 16},  // backslash
+  {1901, 11, 25, 0,  0, 12},  // ]
+  {1936, 15, 17, 0,  0, 16},  // ^
+  {1968, 16,  2, 0, 21, 17},  // _
+  {1972,  4,  1, 0,  0,  5},  // `
+  {1973, 15, 15, 0,  6, 16},  // a
+  {2002, 14, 21, 0,  0, 15},  // b
+  {2039, 15, 15, 0,  6, 16},  // c
+  {2068, 15, 21, 0,  0, 16},  // d
+  {2108, 15, 15, 0,  6, 16},  // e
+  {2137, 15, 21, 0,  0, 16},  // f
+  {2177, 15, 20, 0,  6, 16},  // g
+  {2215, 14, 21, 0,  0, 15},  // h
+  {2252, 11, 21, 0,  0, 12},  // i
+  {2281, 12, 26, 0,  0, 13},  // j
+  {2320, 14, 21, 0,  0, 15},  // k
+  {2357, 11, 21, 0,  0, 12},  // l
+  {2386, 16, 15, 0,  6, 17},  // m
+  {2416, 14, 15, 0,  6, 15},  // n
+  {2443, 15, 15, 0,  6, 16},  // o
+  {2472, 14, 20, 0,  6, 15},  // p
+  {2507, 14, 20, 0,  6, 15},  // q
+  {2542, 13, 15, 0,  6, 14},  // r
+  {2567, 13, 15, 0,  6, 14},  // s
+  {2592, 15, 18, 0,  3, 16},  // t
+  {2626, 13, 15, 0,  6, 14},  // u
+  {2651, 16, 15, 0,  6, 17},  // v
+  {2681, 16, 15, 0,  6, 17},  // w
+  {2711, 15, 15, 0,  6, 16},  // x
+  {2740, 16, 20, 0,  6, 17},  // y
+  {2780, 15, 15, 0,  6, 16},  // z
+  {2809, 13, 25, 0,  0, 14},  // {
+  {2850,  3, 25, 0,  0,  4},  // |
+  {2860, 13, 25, 0,  0, 14},  // }
+  {2901, 16,  5, 0, 11, 17},  // ~
+  {2911, 10, 10, 0,  0, 11},  // U+00B0
+  {2924, 13, 20, 0,  6, 14},  // U+00B5
+};
+
+static const FontRange Font16x26P_Ranges [] = {
+  {0x0020,  95,   0},
+  {0x00B0,   1,  95},
+  {0x00B5,   1,  96},
+};
+
+// 97 glyphs: 2957 bytes of bits + 776 bytes of glyphs + 24 bytes of ranges
+static const FontPacked Font16x26P_Packed = {3, Font16x26P_Ranges, Font16x26P_Glyphs, Font16x26P_Bits};
 
 
 //
-//	De typedefs voor de 3 fonts
+//	De typedefs voor de 4 fonts
 //
-FontDef Font_7x10 = {7,10,Font7x10};
-FontDef Font_11x18 = {11,18,Font11x18};
-FontDef Font_16x26 = {16,26,Font16x26};
+#if SSD1306_FONT_PAGES == 0
+#define FONT_ROWS(rows)    rows
+#define FONT_PAGES(pages)  NULL
+#elif SSD1306_FONT_PAGES == 1
+#define FONT_ROWS(rows)    NULL
+#define FONT_PAGES(pages)  pages
+#else
+#define FONT_ROWS(rows)    rows
+#define FONT_PAGES(pages)  pages
+#endif
+FontDef Font_6x8 = {6,8,FONT_ROWS(Font6x8),FONT_PAGES(Font6x8_Pages),NULL};
+FontDef Font_7x10 = {7,10,FONT_ROWS(Font7x10),FONT_PAGES(Font7x10_Pages),NULL};
+FontDef Font_11x18 = {11,18,FONT_ROWS(Font11x18),FONT_PAGES(Font11x18_Pages),NULL};
+FontDef Font_16x26 = {16,26,FONT_ROWS(Font16x26),FONT_PAGES(Font16x26_Pages),NULL};
+FontDef Font_6x8P = {6,8,NULL,NULL,&Font6x8P_Packed};
+FontDef Font_7x10P = {8,10,NULL,NULL,&Font7x10P_Packed};
+FontDef Font_11x18P = {12,18,NULL,NULL,&Font11x18P_Packed};
+FontDef Font_16x26P = {17,26,NULL,NULL,&Font16x26P_Packed};
@@ -4,22 +4,70 @@
 #ifndef Fonts
 #define Fonts
 
+//
+// Glyph of a packed font: the box of the set pixels (cropped), its place in
+// the character cell and the pen step (cell: advance x FontHeight, max 32 x 32)
+//
+typedef struct {
+  uint16_t offset;            /*!< Byte offset of the box in the bits */
+  uint8_t width;              /*!< Box width (columns) */
+  uint8_t height;             /*!< Box height (rows) */
+  uint8_t xoffset;            /*!< Left bearing: first column of the box in the cell */
+  uint8_t yoffset;            /*!< First row of the box in the cell */
+  uint8_t advance;            /*!< Pen step (cell width) */
+} FontGlyph;
+
+//
+// Code point range of a packed font: count consecutive code points, their
+// glyphs start at the glyph index
+//
+typedef struct {
+  uint32_t first;             /*!< First code point (Unicode) */
+  uint16_t count;             /*!< Code points in the range */
+  uint16_t glyph;             /*!< Glyph of the first code point */
+} FontRange;
+
+//
+// Packed proportional font: the boxes are bit streams of the columns (every
+// column height bits, bit 0: top row, LSB first), a glyph starts on a byte.
+// The glyphs of a sparse character set (e.g. ASCII, some symbols, Cyrillic)
+// are found with a binary search over the ranges.
+//
+typedef struct {
+  uint16_t ranges;            /*!< Number of ranges */
+  const FontRange *range;     /*!< Ranges, sorted by code point */
+  const FontGlyph *glyphs;    /*!< Glyphs of the ranges */
+  const uint8_t *bits;        /*!< Bit streams of the boxes */
+} FontPacked;
+
 //
 // Structure om font te definieren
 //
 typedef struct {
-  const uint8_t FontWidth;    /*!< Font width in pixels */
+  const uint8_t FontWidth;    /*!< Font width in pixels (packed font: the widest advance) */
   uint8_t FontHeight;         /*!< Font height in pixels */
   const uint16_t *data;       /*!< Pointer to data font data array */
+  const uint8_t *pages;       /*!< Pointer to the page-major font data array (column bytes of 8 rows), NULL: only the rows */
+  const FontPacked *packed;   /*!< Packed proportional font (data and pages are NULL), NULL: not packed */
 } FontDef;
 
 
 //
-// De 3 fonts
+// De 4 fonts
 //
+extern FontDef Font_6x8;
 extern FontDef Font_7x10;
 extern FontDef Font_11x18;
 extern FontDef Font_16x26;
 
+//
+// Packed proportional fonts (the same glyphs, cropped, and U+00B0 degree
+// sign, U+00B5 micro sign)
+//
+extern FontDef Font_6x8P;
+extern FontDef Font_7x10P;
+extern FontDef Font_11x18P;
+extern FontDef Font_16x26P;
+
 #endif
 
@@ -18,139 +18,352 @@
  *  - enable raster interrupt(s) of PAGEx (you can set which PAGE(s) )
  */
 
-#include <math.h>
 #include "ssd1306.h"
 
 #if SSD1306_USE_DMA == 0 && SSD1306_CONTUPDATE == 1
 #error SSD1306_CONTUPDATE only in DMA MODE !
 #endif
 
-// Screen object
-static SSD1306_t SSD1306;
-// Screenbuffer
-static uint8_t SSD1306_Buffer[SSD1306_BUFFER_SIZE];
-// SSD1306 display geometry
-SSD1306_Geometry display_geometry = SSD1306_GEOMETRY;
+#if SSD1306_USE_DMA == 0 && SSD1306_DOUBLEBUF == 1
+#error SSD1306_DOUBLEBUF only in DMA MODE !
+#endif
+
+#if SSD1306_CONTUPDATE == 1 && SSD1306_SHADOW == 1
+#error SSD1306_SHADOW not in continue update mode !
+#endif
+
+// Default display
+SSD1306_t hssd1306;
 
 //
 //  Get a width and height screen size
 //
-static const uint16_t width(void)  { return SSD1306_WIDTH; };
-static const uint16_t height(void)  { return SSD1306_HEIGHT; };
-
-uint16_t ssd1306_GetWidth(void)
+uint16_t ssd1306h_GetWidth(SSD1306_t *dev)
 {
+  (void)dev;
   return SSD1306_WIDTH;
 }
 
-uint16_t ssd1306_GetHeight(void)
+uint16_t ssd1306h_GetHeight(SSD1306_t *dev)
 {
-  return SSD1306_HEIGHT;
+  return dev->Height;
 }
 
-SSD1306_COLOR ssd1306_GetColor(void)
+//
+//  Mark the rectangle (x0, y0) - (x1, y1) as changed in the screenbuffer
+//  (the span is stored with one halfword write, so the DMA interrupt
+//  cannot lose a mark, at most it sends a column twice)
+//
+static void ssd1306_MarkDirty(SSD1306_t *dev, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
 {
-  return SSD1306.Color;
+  uint8_t page;
+  uint8_t lo, hi;
+  uint16_t span;
+
+  for (page = y0 >> 3; page <= (y1 >> 3); page++)
+  {
+    span = dev->Dirty[page];
+    lo = span & 0xFF;
+    hi = span >> 8;
+    if (x0 < lo) lo = x0;
+    if (x1 > hi) hi = x1;
+    dev->Dirty[page] = lo | (hi << 8);
+  }
 }
 
-void ssd1306_SetColor(SSD1306_COLOR color)
+//
+//  Mark the whole screenbuffer as changed (the next update sends all pages,
+//  the shadow is not trusted: e.g. the display RAM was changed by scrolling)
+//
+void ssd1306h_Invalidate(SSD1306_t *dev)
 {
-  SSD1306.Color = color;
+  #if SSD1306_SHADOW == 1
+  dev->ShadowValid = 0;
+  #endif
+  ssd1306_MarkDirty(dev, 0, 0, SSD1306_WIDTH - 1, dev->Height - 1);
 }
 
-//  Initialize the oled screen
-uint8_t ssd1306_Init(void)
+SSD1306_COLOR ssd1306h_GetColor(SSD1306_t *dev)
 {
-  /* Check if LCD connected to I2C */
-  if (HAL_I2C_IsDeviceReady(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 5, 1000) != HAL_OK)
+  return dev->Color;
+}
+
+void ssd1306h_SetColor(SSD1306_t *dev, SSD1306_COLOR color)
+{
+  dev->Color = color;
+}
+
+//
+//  Color of the drawing (Inverted swaps White and Black)
+//
+static inline SSD1306_COLOR ssd1306_DrawColor(SSD1306_t *dev)
+{
+  if (dev->Inverted && dev->Color != Inverse)
+    return (SSD1306_COLOR) !dev->Color;
+  return dev->Color;
+}
+
+// Byte b in the 4 bytes of a word
+#define SSD1306_BYTES4(b)       (0x01010101UL * (uint8_t)(b))
+
+// 4 bytes of the screenbuffer as a word (any alignment)
+static inline uint32_t ssd1306_Load32(const uint8_t *p)
+{
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+static inline void ssd1306_Store32(uint8_t *p, uint32_t v)
+{
+  memcpy(p, &v, 4);
+}
+
+//
+//  Span fill kernel: d = (d & a) ^ x on n bytes, the aligned middle with
+//  32-bit words (a = 0: stores only)
+//    White: a = ~m, x = m   Black: a = ~m, x = 0   Inverse: a = 0xFF, x = m
+//
+static void ssd1306_FillBytes(uint8_t *d, uint16_t n, uint8_t a, uint8_t x)
+{
+  uint32_t a4 = SSD1306_BYTES4(a);
+  uint32_t x4 = SSD1306_BYTES4(x);
+
+  for (; n && ((uintptr_t)d & 3); n--, d++)
+    *d = (*d & a) ^ x;
+  if (a == 0)
   {
-    SSD1306.Initialized = 0;
-    /* Return false */
-    return 0;
+    for (; n >= 4; n -= 4, d += 4)
+      ssd1306_Store32(d, x4);
+  }
+  else
+  {
+    for (; n >= 4; n -= 4, d += 4)
+      ssd1306_Store32(d, (ssd1306_Load32(d) & a4) ^ x4);
   }
+  for (; n; n--, d++)
+    *d = (*d & a) ^ x;
+}
 
-  // Wait for the screen to boot
-  HAL_Delay(100);
+//
+//  Fill the rows of mask m in n bytes of a page with the color
+//
+static inline void ssd1306_FillMask(uint8_t *d, uint16_t n, uint8_t m, SSD1306_COLOR color)
+{
+  ssd1306_FillBytes(d, n, (color == Inverse) ? 0xFF : ~m, (color == Black) ? 0x00 : m);
+}
 
-  /* Init LCD */
-  ssd1306_WriteCommand(DISPLAYOFF);
-  ssd1306_WriteCommand(SETDISPLAYCLOCKDIV);
-  ssd1306_WriteCommand(0xF0); // Increase speed of the display max ~96Hz
-  ssd1306_WriteCommand(SETMULTIPLEX);
-  ssd1306_WriteCommand(height() - 1);
-  ssd1306_WriteCommand(SETDISPLAYOFFSET);
-  ssd1306_WriteCommand(0x00);
-  ssd1306_WriteCommand(SETSTARTLINE);
-  ssd1306_WriteCommand(CHARGEPUMP);
-  ssd1306_WriteCommand(0x14);
-  ssd1306_WriteCommand(MEMORYMODE);
-  ssd1306_WriteCommand(0x00);
-  ssd1306_WriteCommand(SEGREMAP);
-  ssd1306_WriteCommand(COMSCANINC);
-  ssd1306_WriteCommand(SETCOMPINS);
+// Integer division rounded down (d > 0)
+static int32_t ssd1306_FloorDiv(int32_t n, int32_t d)
+{
+  return (n >= 0) ? n / d : -((-n + d - 1) / d);
+}
+
+#if SSD1306_USE_DMA == 1
+// Displays served by the DMA interrupt
+static SSD1306_t *ssd1306_Devices = NULL;
+#endif
 
-  if (display_geometry == GEOMETRY_128_64)
+//
+//  Initialize the oled screen
+//  port, address: I2C port and address (0x3C or 0x3D) of the display
+//  geometry: GEOMETRY_128_64 or GEOMETRY_128_32 (the height cannot be greater than SSD1306_HEIGHT)
+//
+uint8_t ssd1306h_Init(SSD1306_t *dev, I2C_HandleTypeDef *port, uint8_t address, SSD1306_Geometry geometry)
+{
+  uint8_t page;
+
+  dev->Initialized = 0;
+  dev->Port = port;
+  dev->Address = address << 1;
+  dev->Geometry = geometry;
+  dev->Height = (geometry == GEOMETRY_128_64) ? 64 : 32;
+  dev->Pages = dev->Height / 8;
+  if (dev->Height > SSD1306_HEIGHT)
   {
-    ssd1306_WriteCommand(0x12);
+    return 0;
   }
-  else if (display_geometry == GEOMETRY_128_32)
+
+  /* Check if LCD connected to I2C */
+  if (HAL_I2C_IsDeviceReady(dev->Port, dev->Address, 5, 1000) != HAL_OK)
   {
-    ssd1306_WriteCommand(0x02);
+    /* Return false */
+    return 0;
   }
 
-  ssd1306_WriteCommand(SETCONTRAST);
-
-  if (display_geometry == GEOMETRY_128_64)
+  // Screenbuffer(s), address window, nothing to send
+  dev->Buffer = dev->Buffers[0];
+  dev->Front = dev->Buffers[SSD1306_DOUBLEBUF];
+  for (page = 0; page < dev->Pages; page++)
+  {
+    dev->Dirty[page] = 0x00FF;
+    #if SSD1306_DOUBLEBUF == 1
+    dev->FrontDirty[page] = 0x00FF;
+    #endif
+  }
+  dev->Window[0] = COLUMNADDR;
+  dev->Window[1] = 0;
+  dev->Window[2] = SSD1306_WIDTH - 1;
+  dev->Window[3] = PAGEADDR;
+  dev->Window[4] = 0;
+  dev->Window[5] = dev->Pages - 1;
+  dev->StartLine = 0;
+  dev->ShownStartLine = 0;
+  dev->ConsoleFont = NULL;
+  dev->ConsoleFontPacked = NULL;
+  dev->ConsoleUtf8Len = 0;
+  dev->Scrolling = 0;
+  dev->ScrollArea[0] = 0;
+  dev->ScrollArea[1] = dev->Height;
+  ssd1306h_ResetClipRect(dev);
+
+  #if SSD1306_DOUBLEBUF == 1
+  dev->SwapRequest = 0;
+  dev->FrontStartLine = 0;
+  #endif
+  #if SSD1306_SHADOW == 1
+  dev->ShadowValid = 0;
+  #endif
+  #if SSD1306_STATS == 1
+  ssd1306h_ResetStats(dev);
+  #endif
+  #if SSD1306_USE_DMA == 1
+  dev->UpdateStatus = 0;
+  dev->BusRequest = 0;
+  dev->CmdSize = 0;
+  #if SSD1306_CONTUPDATE == 0
+  dev->UpdateRestart = 0;
+  dev->UpdateCompletedCallback = NULL;
+  #else
+  dev->ContUpdate = 0;
+  dev->RasterIntCallback = NULL;
+  dev->RasterIntRegs = 0;
+  dev->BandPages = 1;
+  dev->BandRenderer = NULL;
+  dev->CmdHead = 0;
+  dev->CmdTail = 0;
+  #endif
+
+  // Join the list of the DMA interrupt
+  SSD1306_t *d = ssd1306_Devices;
+  while (d != NULL && d != dev)
   {
-    ssd1306_WriteCommand(0xCF);
+    d = d->Next;
   }
-  else if (display_geometry == GEOMETRY_128_32)
+  if (d == NULL)
   {
-    ssd1306_WriteCommand(0x8F);
+    dev->Next = ssd1306_Devices;
+    ssd1306_Devices = dev;
   }
+  #endif
+
+  // Wait for the screen to boot
+  HAL_Delay(100);
 
-  ssd1306_WriteCommand(SETPRECHARGE);
-  ssd1306_WriteCommand(0xF1);
-  ssd1306_WriteCommand(SETVCOMDETECT); //0xDB, (additionally needed to lower the contrast)
-  ssd1306_WriteCommand(0x40);          //0x40 default, to lower the contrast, put 0
-  ssd1306_WriteCommand(DISPLAYALLON_RESUME);
-  ssd1306_WriteCommand(NORMALDISPLAY);
-  ssd1306_WriteCommand(0x2e);            // stop scroll
-  ssd1306_WriteCommand(DISPLAYON);
+  /* Init LCD */
+  uint8_t init[] = {
+    DISPLAYOFF,
+    SETDISPLAYCLOCKDIV, 0xF0,         // Increase speed of the display max ~96Hz
+    SETMULTIPLEX, dev->Height - 1,
+    SETDISPLAYOFFSET, 0x00,
+    SETSTARTLINE,
+    CHARGEPUMP, 0x14,
+    MEMORYMODE, 0x00,                 // Horizontal addressing mode
+    SEGREMAP,
+    COMSCANINC,
+    SETCOMPINS, (geometry == GEOMETRY_128_64) ? 0x12 : 0x02,
+    SETCONTRAST, (geometry == GEOMETRY_128_64) ? 0xCF : 0x8F,
+    SETPRECHARGE, 0xF1,
+    SETVCOMDETECT, 0x40,              // 0xDB, 0x40 default, to lower the contrast, put 0
+    DISPLAYALLON_RESUME,
+    NORMALDISPLAY,
+    DEACTIVATESCROLL,
+    DISPLAYON
+  };
+  ssd1306h_WriteCommands(dev, init, sizeof(init));
 
   // Set default values for screen object
-  SSD1306.CurrentX = 0;
-  SSD1306.CurrentY = 0;
-  SSD1306.Color = Black;
+  dev->CurrentX = 0;
+  dev->CurrentY = 0;
+  dev->Color = Black;
+  dev->Inverted = 0;
 
   // Clear screen
-  ssd1306_Clear();
+  ssd1306h_Clear(dev);
 
   // Continuous Update on
-  ssd1306_ContUpdateEnable();
+  ssd1306h_ContUpdateEnable(dev);
 
   // Flush buffer to screen
-  ssd1306_UpdateScreen();
+  ssd1306h_UpdateScreen(dev);
 
-  SSD1306.Initialized = 1;
+  dev->Initialized = 1;
 
 
   /* Return OK */
   return 1;
 }
 
+#if SSD1306_USE_DMA == 1 && SSD1306_CONTUPDATE == 0
+static void ssd1306_DefaultCompleted(SSD1306_t *dev)
+{
+  (void)dev;
+  ssd1306_UpdateCompletedCallback();
+}
+#elif SSD1306_USE_DMA == 1 && SSD1306_CONTUPDATE == 1
+static void ssd1306_DefaultRasterInt(SSD1306_t *dev, uint8_t r)
+{
+  (void)dev;
+  ssd1306_RasterIntCallback(r);
+}
+#endif
+
 //
-//  Fill the whole screen with the given color
+//  Initialize the default display (SSD1306_I2C_PORT, SSD1306_ADDRESS, SSD1306_GEOMETRY)
 //
-void ssd1306_Fill(void)
+uint8_t ssd1306_Init(void)
 {
-  /* Set memory */
-  uint32_t i;
+  uint8_t ret = ssd1306h_Init(&hssd1306, &SSD1306_I2C_PORT, SSD1306_ADDRESS, SSD1306_GEOMETRY);
+
+  // The callbacks of the handle are set after the init
+  #if SSD1306_USE_DMA == 1 && SSD1306_CONTUPDATE == 0
+  hssd1306.UpdateCompletedCallback = ssd1306_DefaultCompleted;
+  #elif SSD1306_USE_DMA == 1 && SSD1306_CONTUPDATE == 1
+  hssd1306.RasterIntCallback = ssd1306_DefaultRasterInt;
+  #endif
+  return ret;
+}
 
-  for(i = 0; i < sizeof(SSD1306_Buffer); i++)
-  {
-    SSD1306_Buffer[i] = (SSD1306.Color == Black) ? 0x00 : 0xFF;
-  }
+//
+//  Fill the whole screen with the given color (Inverse: invert the screen)
+//
+void ssd1306h_Fill(SSD1306_t *dev)
+{
+  SSD1306_COLOR color = ssd1306_DrawColor(dev);
+
+  ssd1306_FillMask(dev->Buffer, SSD1306_WIDTH * dev->Pages, 0xFF, color);
+  if (color != Inverse)
+    dev->StartLine = 0;
+  ssd1306_MarkDirty(dev, 0, 0, SSD1306_WIDTH - 1, dev->Height - 1);
+}
+
+//
+//  Invert the whole screen
+//
+void ssd1306h_InvertBuffer(SSD1306_t *dev)
+{
+  ssd1306_FillBytes(dev->Buffer, SSD1306_WIDTH * dev->Pages, 0xFF, 0xFF);
+  ssd1306_MarkDirty(dev, 0, 0, SSD1306_WIDTH - 1, dev->Height - 1);
+}
+
+//
+//  Copy a whole screen (Width * Height / 8 bytes, the screenbuffer format) into the screenbuffer
+//
+void ssd1306h_CopyBuffer(SSD1306_t *dev, const uint8_t *src)
+{
+  memcpy(dev->Buffer, src, SSD1306_WIDTH * dev->Pages);
+  dev->StartLine = 0;
+  ssd1306_MarkDirty(dev, 0, 0, SSD1306_WIDTH - 1, dev->Height - 1);
 }
 
 //
@@ -159,36 +372,70 @@ void ssd1306_Fill(void)
 //  Y => Y Coordinate
 //  color => Pixel color
 //
-void ssd1306_DrawPixel(uint8_t x, uint8_t y)
+void ssd1306h_DrawPixel(SSD1306_t *dev, uint8_t x, uint8_t y)
 {
-  SSD1306_COLOR color = SSD1306.Color;
-
-  if (x >= ssd1306_GetWidth() || y >= ssd1306_GetHeight())
+  if (x < dev->Clip[0] || x >= dev->Clip[2] || y < dev->Clip[1] || y >= dev->Clip[3])
   {
-    // Don't write outside the buffer
+    // Don't write outside the buffer (the clip rectangle)
     return;
   }
 
-  // Check if pixel should be inverted
-  if (SSD1306.Inverted)
+  // Draw in the right color (Inverted swaps White and Black)
+  switch (ssd1306_DrawColor(dev))
   {
-    color = (SSD1306_COLOR) !color;
+    case White:   dev->Buffer[x + (y / 8) * SSD1306_WIDTH] |=  1 << (y % 8); break;
+    case Black:   dev->Buffer[x + (y / 8) * SSD1306_WIDTH] &= ~(1 << (y % 8)); break;
+    case Inverse: dev->Buffer[x + (y / 8) * SSD1306_WIDTH] ^=  1 << (y % 8); break;
   }
+  ssd1306_MarkDirty(dev, x, y, x, y);
+}
+
+//
+//  Draw the rows of mask m in n bytes (a short run byte by byte)
+//
+static inline void ssd1306_DrawRun(uint8_t *p, uint16_t n, uint8_t m, SSD1306_COLOR color)
+{
+  uint8_t a = (color == Inverse) ? 0xFF : ~m;
+  uint8_t x = (color == Black) ? 0x00 : m;
 
-  // Draw in the right color
-  if (color == White)
+  if (n >= 8)
   {
-    SSD1306_Buffer[x + (y / 8) * width()] |= 1 << (y % 8);
+    ssd1306_FillBytes(p, n, a, x);
+    return;
   }
-  else
+  while (n--)
   {
-    SSD1306_Buffer[x + (y / 8) * width()] &= ~(1 << (y % 8));
+    *p = (*p & a) ^ x;
+    p++;
   }
 }
 
-void ssd1306_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+//
+//  Line (Bresenham)
+//  The line is clipped before drawing: the first and the last step in the
+//  clip rectangle are computed from the error term, so the drawn pixels are
+//  the same as of the whole line. A flat line is drawn in runs (one row, a
+//  span of bytes), a steep line in bytes (the rows of a column in a page).
+//
+void ssd1306h_DrawLine(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
   int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+  int16_t dx, dy, ystep, e0, x, y, run, mark, page, bits;
+  int16_t cmin, cmax, rmin, rmax;
+  int32_t k0, k1, m, err, n;
+  SSD1306_COLOR color;
+
+  if (y0 == y1)
+  {
+    ssd1306h_DrawHorizontalLine(dev, (x0 < x1) ? x0 : x1, y0, abs(x1 - x0) + 1);
+    return;
+  }
+  if (x0 == x1)
+  {
+    ssd1306h_DrawVerticalLine(dev, x0, (y0 < y1) ? y0 : y1, abs(y1 - y0) + 1);
+    return;
+  }
+
   if (steep)
   {
     SWAP_INT16_T(x0, y0);
@@ -201,344 +448,585 @@ void ssd1306_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
     SWAP_INT16_T(y0, y1);
   }
 
-  int16_t dx, dy;
   dx = x1 - x0;
   dy = abs(y1 - y0);
-
-  int16_t err = dx / 2;
-  int16_t ystep;
-
-  if (y0 < y1)
+  e0 = dx / 2;
+  ystep = (y0 < y1) ? 1 : -1;
+
+  // Clip rectangle in the x (major) and y (minor) of the line
+  cmin = dev->Clip[steep ? 1 : 0];
+  cmax = dev->Clip[steep ? 3 : 2] - 1;
+  rmin = dev->Clip[steep ? 0 : 1];
+  rmax = dev->Clip[steep ? 2 : 3] - 1;
+
+  // Step k: x = x0 + k, y = y0 + ystep * m, m = ceil((k * dy - e0) / dx) (>= 0)
+  // First and last step in the clip rectangle
+  k0 = (cmin > x0) ? cmin - x0 : 0;
+  k1 = (cmax < x1) ? cmax - x0 : dx;
+  if (ystep > 0)
   {
-    ystep = 1;
+    m = rmin - y0;
+    n = rmax - y0;
   }
   else
   {
-    ystep = -1;
+    m = y0 - rmax;
+    n = y0 - rmin;
   }
+  if (n < 0)
+    return;
+  if (m > 0 && ((m - 1) * dx + e0) / dy + 1 > k0)
+    k0 = ((m - 1) * dx + e0) / dy + 1;
+  if ((n * dx + e0) / dy < k1)
+    k1 = (n * dx + e0) / dy;
+  if (k0 > k1)
+    return;
+
+  // State of the first step
+  m = (k0 * dy > e0) ? (k0 * dy - e0 + dx - 1) / dx : 0;
+  err = e0 - k0 * dy + m * dx;
+  x = x0 + k0;
+  y = y0 + ystep * m;
+  n = k1 - k0 + 1;
+  color = ssd1306_DrawColor(dev);
 
-  for (; x0<=x1; x0++)
+  if (!steep)
   {
-    if (steep)
+    // Runs of a row, the dirty span is marked by pages
+    run = x;
+    mark = x;
+    while (n--)
     {
-      ssd1306_DrawPixel(y0, x0);
-    }
-    else
-    {
-      ssd1306_DrawPixel(x0, y0);
+      err -= dy;
+      if (err < 0 || n == 0)
+      {
+        ssd1306_DrawRun(&dev->Buffer[SSD1306_WIDTH * (y >> 3) + run], x - run + 1, 1 << (y & 7), color);
+        if (n == 0 || (err < 0 && ((y + ystep) >> 3) != (y >> 3)))
+        {
+          ssd1306_MarkDirty(dev, mark, y, x, y);
+          mark = x + 1;
+        }
+        run = x + 1;
+      }
+      if (err < 0)
+      {
+        y += ystep;
+        err += dx;
+      }
+      x++;
     }
-    err -= dy;
-    if (err < 0)
+  }
+  else
+  {
+    // Rows of a column in a page: one byte, the dirty span is marked by pages
+    bits = 0;
+    page = x >> 3;
+    mark = y;
+    while (n--)
     {
-      y0 += ystep;
-      err += dx;
+      bits |= 1 << (x & 7);
+      err -= dy;
+      if (err < 0 || n == 0 || ((x + 1) >> 3) != page)
+      {
+        ssd1306_DrawRun(&dev->Buffer[SSD1306_WIDTH * page + y], 1, bits, color);
+        bits = 0;
+      }
+      if (n == 0 || ((x + 1) >> 3) != page)
+      {
+        ssd1306_MarkDirty(dev, (mark < y) ? mark : y, page << 3, (mark < y) ? y : mark, page << 3);
+        page = (x + 1) >> 3;
+        mark = (err < 0) ? y + ystep : y;
+      }
+      if (err < 0)
+      {
+        y += ystep;
+        err += dx;
+      }
+      x++;
     }
   }
 }
 
-void ssd1306_DrawHorizontalLine(int16_t x, int16_t y, int16_t length)
+void ssd1306h_DrawHorizontalLine(SSD1306_t *dev, int16_t x, int16_t y, int16_t length)
+{
+  ssd1306h_FillRect(dev, x, y, length, 1);
+}
+
+void ssd1306h_DrawVerticalLine(SSD1306_t *dev, int16_t x, int16_t y, int16_t length)
+{
+  ssd1306h_FillRect(dev, x, y, 1, length);
+}
+
+void ssd1306h_DrawRect(SSD1306_t *dev, int16_t x, int16_t y, int16_t width, int16_t height)
+{
+  ssd1306h_DrawHorizontalLine(dev, x, y, width);
+  ssd1306h_DrawVerticalLine(dev, x, y, height);
+  ssd1306h_DrawVerticalLine(dev, x + width - 1, y, height);
+  ssd1306h_DrawHorizontalLine(dev, x, y + height - 1, width);
+}
+
+//
+//  Fill a rectangle: every page is a span of bytes with a row mask (the top
+//  and the bottom page masked, the pages between full bytes)
+//
+void ssd1306h_FillRect(SSD1306_t *dev, int16_t xMove, int16_t yMove, int16_t width, int16_t height)
 {
-  if (y < 0 || y >= height()) { return; }
+  int16_t x0 = (xMove > dev->Clip[0]) ? xMove : dev->Clip[0];
+  int16_t y0 = (yMove > dev->Clip[1]) ? yMove : dev->Clip[1];
+  int16_t x1 = (xMove + width < dev->Clip[2]) ? xMove + width : dev->Clip[2];
+  int16_t y1 = (yMove + height < dev->Clip[3]) ? yMove + height : dev->Clip[3];
+  SSD1306_COLOR color = ssd1306_DrawColor(dev);
+  uint8_t page, first, last, topmask, bottommask;
+  uint8_t *p;
+
+  if (x0 >= x1 || y0 >= y1)
+    return;
 
-  if (x < 0)
+  first = y0 >> 3;
+  last = (y1 - 1) >> 3;
+  topmask = 0xFF << (y0 & 7);
+  bottommask = 0xFF >> (7 - ((y1 - 1) & 7));
+  p = &dev->Buffer[SSD1306_WIDTH * first + x0];
+  if (first == last)
   {
-    length += x;
-    x = 0;
+    ssd1306_FillMask(p, x1 - x0, topmask & bottommask, color);
   }
-
-  if ( (x + length) > width())
+  else
   {
-    length = (width() - x);
+    ssd1306_FillMask(p, x1 - x0, topmask, color);
+    for (page = first + 1; page < last; page++)
+    {
+      p += SSD1306_WIDTH;
+      ssd1306_FillMask(p, x1 - x0, 0xFF, color);
+    }
+    ssd1306_FillMask(p + SSD1306_WIDTH, x1 - x0, bottommask, color);
   }
+  ssd1306_MarkDirty(dev, x0, y0, x1 - 1, y1 - 1);
+}
 
-  if (length <= 0) { return; }
+void ssd1306h_DrawTriangle(SSD1306_t *dev, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3)
+{
+  /* Draw lines */
+  ssd1306h_DrawLine(dev, x1, y1, x2, y2);
+  ssd1306h_DrawLine(dev, x2, y2, x3, y3);
+  ssd1306h_DrawLine(dev, x3, y3, x1, y1);
+}
 
-  uint8_t * bufferPtr = SSD1306_Buffer;
-  bufferPtr += (y >> 3) * width();
-  bufferPtr += x;
+typedef struct {
+  int16_t x, y;
+} ssd1306_Point;
 
-  uint8_t drawBit = 1 << (y & 7);
+static void ssd1306_FillPoints(SSD1306_t *dev, const ssd1306_Point *vertex, uint16_t size, SSD1306_FillRule rule);
 
-  switch (SSD1306.Color)
-  {
-    case White:
-      while (length--)
-      {
-        *bufferPtr++ |= drawBit;
-      };
-      break;
-    case Black:
-      drawBit = ~drawBit;
-      while (length--)
-      {
-        *bufferPtr++ &= drawBit;
-      };
-      break;
-    case Inverse:
-      while (length--)
-      {
-        *bufferPtr++ ^= drawBit;
-      }; break;
-  }
+//
+//  Filled triangle: the coordinates are signed (e.g. -10 as uint16_t), the
+//  parts outside the clip rectangle are cut off
+//
+void ssd1306h_DrawFillTriangle(SSD1306_t *dev, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3)
+{
+  ssd1306_Point v[3] = {{(int16_t)x1, (int16_t)y1}, {(int16_t)x2, (int16_t)y2}, {(int16_t)x3, (int16_t)y3}};
+
+  ssd1306_FillPoints(dev, v, 3, FILL_NONZERO);
 }
 
-void ssd1306_DrawVerticalLine(int16_t x, int16_t y, int16_t length)
+/* Draw polyline */
+void ssd1306h_Polyline(SSD1306_t *dev, const SSD1306_VERTEX *par_vertex, uint16_t par_size)
 {
-  if (x < 0 || x >= width()) return;
-
-  if (y < 0)
+  uint16_t i;
+  if(par_vertex != 0)
   {
-    length += y;
-    y = 0;
+    for(i = 1; i < par_size; i++)
+    {
+      ssd1306h_DrawLine(dev, par_vertex[i - 1].x, par_vertex[i - 1].y, par_vertex[i].x, par_vertex[i].y);
+    }
   }
-
-  if ( (y + length) > height())
+  else
   {
-    length = (height() - y);
+    /*nothing to do*/
   }
+  return;
+}
+
+//
+//  Scanline polygon fill
+//  Every row of the polygon is a list of spans: the inside between the edge
+//  crossings of the row center (the edges are half-open in y, so a vertex is
+//  crossed once), and the pixels of the edges in the row (the outline belongs
+//  to the polygon, as the lines of DrawTriangle / Polyline). The spans are
+//  merged, so every pixel is drawn once (also with Inverse).
+//  Coordinates: int16_t vertices, Q8 fixed point edges.
+//
+typedef struct {
+  int16_t lo, hi;
+} ssd1306_Span;
 
-  if (length <= 0) return;
+// x of the edge (xa, ya) - (xb, yb) at the half row q (row y: q = 2 * y) in Q8
+// (2 * ya <= q <= 2 * yb; a long edge, far outside the screen, is computed in 64 bits)
+static inline int32_t ssd1306_EdgeX(int16_t xa, int16_t ya, int16_t xb, int16_t yb, int16_t q)
+{
+  int32_t dx = xb - xa, dy = 2 * (yb - ya), dq = q - 2 * ya;
+  int64_t n;
 
+  if (dx > -2048 && dx < 2048 && dy < 2048)
+    return xa * 256 + ssd1306_FloorDiv(dq * dx * 256, dy);
+  n = (int64_t)dq * dx * 256;
+  return xa * 256 + (int32_t)((n >= 0) ? n / dy : -((-n + dy - 1) / dy));
+}
 
-  uint8_t yOffset = y & 7;
-  uint8_t drawBit;
-  uint8_t *bufferPtr = SSD1306_Buffer;
+static void ssd1306_AddSpan(ssd1306_Span *spans, uint16_t *n, int16_t lo, int16_t hi)
+{
+  uint16_t i = *n;
 
-  bufferPtr += (y >> 3) * width();
-  bufferPtr += x;
+  if (lo > hi)
+    return;
+  while (i > 0 && spans[i - 1].lo > lo)
+  {
+    spans[i] = spans[i - 1];
+    i--;
+  }
+  spans[i].lo = lo;
+  spans[i].hi = hi;
+  (*n)++;
+}
 
-  if (yOffset)
+static void ssd1306_FillPoints(SSD1306_t *dev, const ssd1306_Point *vertex, uint16_t size, SSD1306_FillRule rule)
+{
+  int32_t cx[SSD1306_POLYGON_MAXVERTICES], c, x0, x1;
+  int8_t cdir[SSD1306_POLYGON_MAXVERTICES], dir;
+  ssd1306_Span spans[2 * SSD1306_POLYGON_MAXVERTICES];
+  uint16_t i, j, nc, ns;
+  int16_t xa, ya, xb, yb, y, ymin, ymax, lo, hi;
+  int8_t winding;
+
+  ymin = ymax = vertex[0].y;
+  for (i = 1; i < size; i++)
   {
-    yOffset = 8 - yOffset;
-    drawBit = ~(0xFF >> (yOffset));
+    if (vertex[i].y < ymin) ymin = vertex[i].y;
+    if (vertex[i].y > ymax) ymax = vertex[i].y;
+  }
+  if (ymin < dev->Clip[1]) ymin = dev->Clip[1];
+  if (ymax > dev->Clip[3] - 1) ymax = dev->Clip[3] - 1;
 
-    if (length < yOffset)
+  for (y = ymin; y <= ymax; y++)
+  {
+    nc = 0;
+    ns = 0;
+    for (i = 0; i < size; i++)
     {
-      drawBit &= (0xFF >> (yOffset - length));
+      j = (i + 1 < size) ? i + 1 : 0;
+      xa = vertex[i].x; ya = vertex[i].y;
+      xb = vertex[j].x; yb = vertex[j].y;
+      dir = 1;
+      if (ya > yb)
+      {
+        SWAP_INT16_T(xa, xb);
+        SWAP_INT16_T(ya, yb);
+        dir = -1;
+      }
+      if (y < ya || y > yb)
+        continue;
+
+      // Pixels of the edge in the row: the part of the edge in y - 0.5 .. y + 0.5
+      if (ya == yb)
+      {
+        ssd1306_AddSpan(spans, &ns, (xa < xb) ? xa : xb, (xa < xb) ? xb : xa);
+        continue;
+      }
+      x0 = ssd1306_EdgeX(xa, ya, xb, yb, (2 * y - 1 > 2 * ya) ? 2 * y - 1 : 2 * ya);
+      x1 = ssd1306_EdgeX(xa, ya, xb, yb, (2 * y + 1 < 2 * yb) ? 2 * y + 1 : 2 * yb);
+      if (x0 > x1)
+      {
+        c = x0; x0 = x1; x1 = c;
+      }
+      lo = (x0 + 128) >> 8;          /* rounded half up */
+      hi = (x1 + 127) >> 8;          /* rounded half down */
+      ssd1306_AddSpan(spans, &ns, lo, (hi > lo) ? hi : lo);
+
+      // Crossing of the row center (sorted)
+      if (y < yb)
+      {
+        c = ssd1306_EdgeX(xa, ya, xb, yb, 2 * y);
+        for (j = nc; j > 0 && cx[j - 1] > c; j--)
+        {
+          cx[j] = cx[j - 1];
+          cdir[j] = cdir[j - 1];
+        }
+        cx[j] = c;
+        cdir[j] = dir;
+        nc++;
+      }
     }
 
-    switch (SSD1306.Color)
+    // Inside: the pixel centers between the crossings
+    winding = 0;
+    for (i = 0; i + 1 < nc; i++)
     {
-      case White:   *bufferPtr |=  drawBit; break;
-      case Black:   *bufferPtr &= ~drawBit; break;
-      case Inverse: *bufferPtr ^=  drawBit; break;
+      winding = (rule == FILL_EVENODD) ? !winding : winding + cdir[i];
+      if (winding)
+        ssd1306_AddSpan(spans, &ns, (cx[i] + 255) >> 8, cx[i + 1] >> 8);
     }
 
-    if (length < yOffset) return;
-
-    length -= yOffset;
-    bufferPtr += width();
-  }
-
-  if (length >= 8)
-  {
-    switch (SSD1306.Color)
+    // Merge the spans and draw them (cut to the clip rectangle)
+    for (i = 0; i < ns; i = j)
     {
-      case White:
-      case Black:
-        drawBit = (SSD1306.Color == White) ? 0xFF : 0x00;
-        do {
-          *bufferPtr = drawBit;
-          bufferPtr += width();
-          length -= 8;
-        } while (length >= 8);
-        break;
-      case Inverse:
-        do {
-          *bufferPtr = ~(*bufferPtr);
-          bufferPtr += width();
-          length -= 8;
-        } while (length >= 8);
-        break;
+      hi = spans[i].hi;
+      for (j = i + 1; j < ns && spans[j].lo <= hi + 1; j++)
+      {
+        if (spans[j].hi > hi)
+          hi = spans[j].hi;
+      }
+      lo = (spans[i].lo > dev->Clip[0]) ? spans[i].lo : dev->Clip[0];
+      if (hi > dev->Clip[2] - 1)
+        hi = dev->Clip[2] - 1;
+      if (lo <= hi)
+        ssd1306h_DrawHorizontalLine(dev, lo, y, hi - lo + 1);
     }
   }
+}
+
+void ssd1306h_FillPolygon(SSD1306_t *dev, const SSD1306_VERTEX *vertex, uint16_t size, SSD1306_FillRule rule)
+{
+  ssd1306_Point p[SSD1306_POLYGON_MAXVERTICES];
+  uint16_t i;
 
-  if (length > 0)
+  if (vertex == NULL || size == 0 || size > SSD1306_POLYGON_MAXVERTICES)
+    return;
+  for (i = 0; i < size; i++)
   {
-    drawBit = (1 << (length & 7)) - 1;
-    switch (SSD1306.Color)
-    {
-      case White:   *bufferPtr |=  drawBit; break;
-      case Black:   *bufferPtr &= ~drawBit; break;
-      case Inverse: *bufferPtr ^=  drawBit; break;
-    }
+    p[i].x = vertex[i].x;
+    p[i].y = vertex[i].y;
   }
+  ssd1306_FillPoints(dev, p, size, rule);
 }
 
-void ssd1306_DrawRect(int16_t x, int16_t y, int16_t width, int16_t height)
+//
+//  Integer sine: sin(deg) * 16384 (Q14) from a quarter wave table
+//  The angles of the arcs and pies: 0 degree at the bottom, 90 on the right,
+//  180 on the top, 270 on the left (the direction of deg is (sin, cos)).
+//
+static const uint16_t ssd1306_SinTable[91] = {
+      0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+   2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+   5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+   8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384
+};
+
+int16_t ssd1306_Sin(int16_t deg)
 {
-  ssd1306_DrawHorizontalLine(x, y, width);
-  ssd1306_DrawVerticalLine(x, y, height);
-  ssd1306_DrawVerticalLine(x + width - 1, y, height);
-  ssd1306_DrawHorizontalLine(x, y + height - 1, width);
+  deg %= 360;
+  if (deg < 0)
+    deg += 360;
+  if (deg <= 90)
+    return ssd1306_SinTable[deg];
+  if (deg <= 180)
+    return ssd1306_SinTable[180 - deg];
+  if (deg <= 270)
+    return -ssd1306_SinTable[deg - 180];
+  return -ssd1306_SinTable[360 - deg];
 }
 
-void ssd1306_FillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height)
+int16_t ssd1306_Cos(int16_t deg)
 {
-  for (int16_t x = xMove; x < xMove + width; x++)
-  {
-    ssd1306_DrawVerticalLine(x, yMove, height);
-  }
+  return ssd1306_Sin(deg + 90);
+}
+
+//
+//  Sector of the angles start .. start + sweep: the directions of the two
+//  edges (Q14). A point p is after the direction v if cross(v, p) >= 0:
+//    cross(v, p) = v.y * p.x - v.x * p.y
+//  sweep <= 180: after the start and before the end; sweep > 180: not in the
+//  open sector end .. start.
+//
+typedef struct {
+  int32_t x0, y0;           // start direction
+  int32_t x1, y1;           // end direction
+  uint16_t sweep;           // degrees (360: all the angles)
+} ssd1306_Sector;
+
+static void ssd1306_SetSector(ssd1306_Sector *s, int16_t start, uint16_t sweep)
+{
+  s->sweep = (sweep > 360) ? 360 : sweep;
+  s->x0 = ssd1306_Sin(start);
+  s->y0 = ssd1306_Cos(start);
+  s->x1 = ssd1306_Sin(start + s->sweep);
+  s->y1 = ssd1306_Cos(start + s->sweep);
 }
 
-void ssd1306_DrawTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3)
+static uint8_t ssd1306_InSector(const ssd1306_Sector *s, int16_t px, int16_t py)
 {
-  /* Draw lines */
-  ssd1306_DrawLine(x1, y1, x2, y2);
-  ssd1306_DrawLine(x2, y2, x3, y3);
-  ssd1306_DrawLine(x3, y3, x1, y1);
+  if (s->sweep >= 360)
+    return 1;
+  if (s->sweep <= 180)
+    return (s->y0 * px - s->x0 * py >= 0) && (s->x1 * py - s->y1 * px >= 0);
+  return !((s->y1 * px - s->x1 * py > 0) && (s->x0 * py - s->y0 * px > 0));
 }
 
-void ssd1306_DrawFillTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3)
+//
+//  x interval of the row py where ay * px - ax * py >= 0 (> 0 with strict)
+//
+static void ssd1306_HalfPlaneRow(int32_t ax, int32_t ay, int16_t py, uint8_t strict, int16_t *lo, int16_t *hi)
 {
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0,
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0,
-  curpixel = 0;
+  int32_t c = ax * py + strict;     /* ay * px >= c */
+
+  *lo = -32767;
+  *hi = 32767;
+  if (ay > 0)
+    *lo = -ssd1306_FloorDiv(-c, ay);
+  else if (ay < 0)
+    *hi = ssd1306_FloorDiv(-c, -ay);
+  else if (c > 0)
+    *lo = 1, *hi = 0;
+}
 
-  deltax = abs(x2 - x1);
-  deltay = abs(y2 - y1);
-  x = x1;
-  y = y1;
+//
+//  Draw the pixels -w .. w of the row py (relative to the center) in the sector
+//
+static void ssd1306_SectorRow(SSD1306_t *dev, const ssd1306_Sector *s, int16_t xm, int16_t ym, int16_t py, int16_t w)
+{
+  int16_t lo0, hi0, lo1, hi1, lo, hi;
 
-  if (x2 >= x1)
+  if (s->sweep >= 360)
   {
-    xinc1 = 1;
-    xinc2 = 1;
+    ssd1306h_DrawHorizontalLine(dev, xm - w, ym + py, 2 * w + 1);
+    return;
   }
-  else
+  if (s->sweep <= 180)
   {
-    xinc1 = -1;
-    xinc2 = -1;
+    ssd1306_HalfPlaneRow(s->x0, s->y0, py, 0, &lo0, &hi0);
+    ssd1306_HalfPlaneRow(-s->x1, -s->y1, py, 0, &lo1, &hi1);
+    lo = (lo0 > lo1) ? lo0 : lo1;
+    hi = (hi0 < hi1) ? hi0 : hi1;
+    if (lo < -w) lo = -w;
+    if (hi > w) hi = w;
+    ssd1306h_DrawHorizontalLine(dev, xm + lo, ym + py, hi - lo + 1);
+    return;
   }
-
-  if (y2 >= y1)
+  // The row without the open sector end .. start (at most two spans)
+  ssd1306_HalfPlaneRow(s->x1, s->y1, py, 1, &lo0, &hi0);
+  ssd1306_HalfPlaneRow(-s->x0, -s->y0, py, 1, &lo1, &hi1);
+  lo = (lo0 > lo1) ? lo0 : lo1;
+  hi = (hi0 < hi1) ? hi0 : hi1;
+  if (lo > hi)
   {
-    yinc1 = 1;
-    yinc2 = 1;
+    ssd1306h_DrawHorizontalLine(dev, xm - w, ym + py, 2 * w + 1);
+    return;
   }
-  else
+  if (lo > -w)
+    ssd1306h_DrawHorizontalLine(dev, xm - w, ym + py, ((lo - 1 < w) ? lo - 1 : w) + w + 1);
+  if (hi < w)
   {
-    yinc1 = -1;
-    yinc2 = -1;
+    if (hi < -w) hi = -w - 1;
+    ssd1306h_DrawHorizontalLine(dev, xm + hi + 1, ym + py, w - hi);
   }
+}
 
-  if (deltax >= deltay)
-  {
-    xinc1 = 0;
-    yinc2 = 0;
-    den = deltax;
-    num = deltax / 2;
-    numadd = deltay;
-    numpixels = deltax;
-  }
-  else
-  {
-    xinc2 = 0;
-    yinc1 = 0;
-    den = deltay;
-    num = deltay / 2;
-    numadd = deltax;
-    numpixels = deltay;
-  }
+//
+//  Ellipse engine (midpoint ellipse, integer errors): the outline pixels in
+//  the sector, or every row of the filled ellipse once (the widest span of
+//  the row, so Inverse draws every pixel once)
+//
+static void ssd1306_Ellipse(SSD1306_t *dev, int16_t xm, int16_t ym, int16_t a, int16_t b, const ssd1306_Sector *s, uint8_t fill)
+{
+  int16_t x = -a, y = 0, lasty = -1;
+  int32_t aa = (int32_t)a * a, bb = (int32_t)b * b;
+  int32_t err = x * (2 * bb + x) + bb, e2;
 
-  for (curpixel = 0; curpixel <= numpixels; curpixel++)
+  if (a < 0 || b < 0)
+    return;
+  do
   {
-    ssd1306_DrawLine(x, y, x3, y3);
-
-    num += numadd;
-    if (num >= den)
+    if (fill)
     {
-      num -= den;
-      x += xinc1;
-      y += yinc1;
+      if (y != lasty)
+      {
+        ssd1306_SectorRow(dev, s, xm, ym, y, -x);
+        if (y != 0)
+          ssd1306_SectorRow(dev, s, xm, ym, -y, -x);
+      }
     }
-    x += xinc2;
-    y += yinc2;
-  }
-}
-
-/* Draw polyline */
-void ssd1306_Polyline(const SSD1306_VERTEX *par_vertex, uint16_t par_size)
-{
-  uint16_t i;
-  if(par_vertex != 0)
-  {
-    for(i = 1; i < par_size; i++)
+    else
     {
-      ssd1306_DrawLine(par_vertex[i - 1].x, par_vertex[i - 1].y, par_vertex[i].x, par_vertex[i].y);
+      if (ssd1306_InSector(s, -x, y)) ssd1306h_DrawPixel(dev, xm - x, ym + y);
+      if (x != 0 && ssd1306_InSector(s, x, y)) ssd1306h_DrawPixel(dev, xm + x, ym + y);
+      if (y != 0)
+      {
+        if (ssd1306_InSector(s, -x, -y)) ssd1306h_DrawPixel(dev, xm - x, ym - y);
+        if (x != 0 && ssd1306_InSector(s, x, -y)) ssd1306h_DrawPixel(dev, xm + x, ym - y);
+      }
     }
-  }
-  else
+    lasty = y;
+    e2 = 2 * err;
+    if (e2 >= (x * 2 + 1) * bb)
+      err += (++x * 2 + 1) * bb;
+    if (e2 <= (y * 2 + 1) * aa)
+      err += (++y * 2 + 1) * aa;
+  } while (x <= 0);
+
+  // Flat ellipse: the rest of the vertical axis
+  for (y = lasty + 1; y <= b; y++)
   {
-    /*nothing to do*/
+    if (fill)
+    {
+      ssd1306_SectorRow(dev, s, xm, ym, y, 0);
+      ssd1306_SectorRow(dev, s, xm, ym, -y, 0);
+    }
+    else
+    {
+      if (ssd1306_InSector(s, 0, y)) ssd1306h_DrawPixel(dev, xm, ym + y);
+      if (ssd1306_InSector(s, 0, -y)) ssd1306h_DrawPixel(dev, xm, ym - y);
+    }
   }
-  return;
 }
 
-/*Convert Degrees to Radians*/
-static float ssd1306_DegToRad(float par_deg)
+/*DrawArc. Draw angle is beginning from 4 quart of trigonometric circle (3pi/2)
+ * start_angle in degree
+ * sweep in degree (from start_angle, 360: whole circle)
+ */
+void ssd1306h_DrawArc(SSD1306_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep)
 {
-  return par_deg * 3.14 / 180.0;
+  ssd1306h_DrawEllipseArc(dev, x, y, radius, radius, start_angle, sweep);
 }
 
-/*Normalize degree to [0;360]*/
-static uint16_t ssd1306_NormalizeTo0_360(uint16_t par_deg)
+void ssd1306h_DrawEllipseArc(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t rx, int16_t ry, int16_t start_angle, uint16_t sweep)
 {
-  uint16_t loc_angle;
-  if(par_deg <= 360)
-  {
-    loc_angle = par_deg;
-  }
-  else
-  {
-    loc_angle = par_deg % 360;
-    loc_angle = ((par_deg != 0) ? par_deg : 360);
-  }
-  return loc_angle;
+  ssd1306_Sector s;
+
+  if (sweep == 0)
+    return;
+  ssd1306_SetSector(&s, start_angle, sweep);
+  ssd1306_Ellipse(dev, x0, y0, rx, ry, &s, 0);
 }
-/*DrawArc. Draw angle is beginning from 4 quart of trigonometric circle (3pi/2)
- * start_angle in degree
- * sweep in degree
- */
-void ssd1306_DrawArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep)
+
+void ssd1306h_DrawEllipse(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t rx, int16_t ry)
 {
-  #define CIRCLE_APPROXIMATION_SEGMENTS 36
-  float approx_degree;
-  uint32_t approx_segments;
-  uint8_t xp1, xp2;
-  uint8_t yp1, yp2;
-  uint32_t count = 0;
-  uint32_t loc_sweep = 0;
-  float rad;
+  ssd1306h_DrawEllipseArc(dev, x0, y0, rx, ry, 0, 360);
+}
 
-  loc_sweep = ssd1306_NormalizeTo0_360(sweep);
+void ssd1306h_FillEllipse(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t rx, int16_t ry)
+{
+  ssd1306h_FillPie(dev, x0, y0, rx, ry, 0, 360);
+}
 
-  count = (ssd1306_NormalizeTo0_360(start_angle) * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
-  approx_segments = (loc_sweep * CIRCLE_APPROXIMATION_SEGMENTS) / 360;
-  approx_degree = loc_sweep / (float)approx_segments;
-  while(count < approx_segments)
-  {
-    rad = ssd1306_DegToRad(count * approx_degree);
-    xp1 = x + (int8_t)(sin(rad) * radius);
-    yp1 = y + (int8_t)(cos(rad) * radius);
-    count++;
-    if(count != approx_segments)
-    {
-      rad = ssd1306_DegToRad(count * approx_degree);
-    }
-    else
-    {
-      rad = ssd1306_DegToRad(loc_sweep);
-    }
-    xp2 = x + (int8_t)(sin(rad) * radius);
-    yp2 = y + (int8_t)(cos(rad) * radius);
-    ssd1306_DrawLine(xp1, yp1, xp2, yp2);
-  }
+//
+//  Filled sector of the ellipse (pie slice)
+//
+void ssd1306h_FillPie(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t rx, int16_t ry, int16_t start_angle, uint16_t sweep)
+{
+  ssd1306_Sector s;
 
-  return;
+  if (sweep == 0)
+    return;
+  ssd1306_SetSector(&s, start_angle, sweep);
+  ssd1306_Ellipse(dev, x0, y0, rx, ry, &s, 1);
 }
 
-void ssd1306_DrawCircle(int16_t x0, int16_t y0, int16_t radius)
+void ssd1306h_DrawCircle(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t radius)
 {
   int16_t x = 0, y = radius;
   int16_t dp = 1 - radius;
@@ -549,49 +1037,113 @@ void ssd1306_DrawCircle(int16_t x0, int16_t y0, int16_t radius)
     else
       dp = dp + 2 * (++x) - 2 * (--y) + 5;
 
-    ssd1306_DrawPixel(x0 + x, y0 + y);     //For the 8 octants
-    ssd1306_DrawPixel(x0 - x, y0 + y);
-    ssd1306_DrawPixel(x0 + x, y0 - y);
-    ssd1306_DrawPixel(x0 - x, y0 - y);
-    ssd1306_DrawPixel(x0 + y, y0 + x);
-    ssd1306_DrawPixel(x0 - y, y0 + x);
-    ssd1306_DrawPixel(x0 + y, y0 - x);
-    ssd1306_DrawPixel(x0 - y, y0 - x);
+    ssd1306h_DrawPixel(dev, x0 + x, y0 + y);     //For the 8 octants
+    ssd1306h_DrawPixel(dev, x0 - x, y0 + y);
+    ssd1306h_DrawPixel(dev, x0 + x, y0 - y);
+    ssd1306h_DrawPixel(dev, x0 - x, y0 - y);
+    ssd1306h_DrawPixel(dev, x0 + y, y0 + x);
+    ssd1306h_DrawPixel(dev, x0 - y, y0 + x);
+    ssd1306h_DrawPixel(dev, x0 + y, y0 - x);
+    ssd1306h_DrawPixel(dev, x0 - y, y0 - x);
 
   } while (x < y);
 
-  ssd1306_DrawPixel(x0 + radius, y0);
-  ssd1306_DrawPixel(x0, y0 + radius);
-  ssd1306_DrawPixel(x0 - radius, y0);
-  ssd1306_DrawPixel(x0, y0 - radius);
+  ssd1306h_DrawPixel(dev, x0 + radius, y0);
+  ssd1306h_DrawPixel(dev, x0, y0 + radius);
+  ssd1306h_DrawPixel(dev, x0 - radius, y0);
+  ssd1306h_DrawPixel(dev, x0, y0 - radius);
 }
 
-void ssd1306_FillCircle(int16_t x0, int16_t y0, int16_t radius)
+//
+//  Rows of a rounded rectangle (a circle: xl == xr, yt == yb)
+//  xl, xr: columns, yt, yb: rows of the corner centers, r: radius. A corner
+//  row j (0 .. r) is e(j) wide: the largest e with e * e + j * j <= r * r + r.
+//  Every row is drawn once (filled: one span, outline: the pixels between
+//  e(j + 1) and e(j) on both sides), so Inverse works.
+//
+static void ssd1306_RoundRows(SSD1306_t *dev, int16_t xl, int16_t xr, int16_t yt, int16_t yb, int16_t r, uint8_t fill)
 {
-  int16_t x = 0, y = radius;
-  int16_t dp = 1 - radius;
-  do
+  int32_t rr = (int32_t)r * r + r;
+  int16_t j, e = r, next = r, lo, y;
+  uint8_t side;
+
+  // Straight part between the corners
+  if (yb - yt > 1)
   {
-    if (dp < 0)
+    if (fill)
+      ssd1306h_FillRect(dev, xl - r, yt + 1, xr - xl + 2 * r + 1, yb - yt - 1);
+    else
     {
-      dp = dp + 2 * (++x) + 3;
+      ssd1306h_DrawVerticalLine(dev, xl - r, yt + 1, yb - yt - 1);
+      if (xr + r != xl - r)
+        ssd1306h_DrawVerticalLine(dev, xr + r, yt + 1, yb - yt - 1);
+    }
+  }
+
+  for (j = 0; j <= r; j++)
+  {
+    e = next;
+    while ((int32_t)e * e + (int32_t)j * j > rr)
+      e--;
+    next = e;
+    if (j < r)
+    {
+      while ((int32_t)next * next + (int32_t)(j + 1) * (j + 1) > rr)
+        next--;
     }
     else
+      next = -1;
+
+    for (side = 0; side < 2; side++)
     {
-      dp = dp + 2 * (++x) - 2 * (--y) + 5;
+      if (side == 0)
+        y = yt - j;
+      else if (yb + j != yt - j)
+        y = yb + j;
+      else
+        break;
+      lo = (next + 1 < e) ? next + 1 : e;
+      if (fill || next < 0 || xl - lo + 1 >= xr + lo)
+        ssd1306h_DrawHorizontalLine(dev, xl - e, y, xr - xl + 2 * e + 1);
+      else
+      {
+        ssd1306h_DrawHorizontalLine(dev, xl - e, y, e - lo + 1);
+        ssd1306h_DrawHorizontalLine(dev, xr + lo, y, e - lo + 1);
+      }
     }
+  }
+}
 
-    ssd1306_DrawHorizontalLine(x0 - x, y0 - y, 2*x);
-    ssd1306_DrawHorizontalLine(x0 - x, y0 + y, 2*x);
-    ssd1306_DrawHorizontalLine(x0 - y, y0 - x, 2*y);
-    ssd1306_DrawHorizontalLine(x0 - y, y0 + x, 2*y);
+void ssd1306h_FillCircle(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t radius)
+{
+  if (radius >= 0)
+    ssd1306_RoundRows(dev, x0, x0, y0, y0, radius, 1);
+}
 
+//
+//  Rounded rectangle: the corner radius is limited to the half of the sides
+//
+void ssd1306h_DrawRoundRect(SSD1306_t *dev, int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius)
+{
+  if (width <= 0 || height <= 0)
+    return;
+  if (radius > (width - 1) / 2) radius = (width - 1) / 2;
+  if (radius > (height - 1) / 2) radius = (height - 1) / 2;
+  if (radius < 0) radius = 0;
+  ssd1306_RoundRows(dev, x + radius, x + width - 1 - radius, y + radius, y + height - 1 - radius, radius, 0);
+}
 
-  } while (x < y);
-  ssd1306_DrawHorizontalLine(x0 - radius, y0, 2 * radius);
+void ssd1306h_FillRoundRect(SSD1306_t *dev, int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius)
+{
+  if (width <= 0 || height <= 0)
+    return;
+  if (radius > (width - 1) / 2) radius = (width - 1) / 2;
+  if (radius > (height - 1) / 2) radius = (height - 1) / 2;
+  if (radius < 0) radius = 0;
+  ssd1306_RoundRows(dev, x + radius, x + width - 1 - radius, y + radius, y + height - 1 - radius, radius, 1);
 }
 
-void ssd1306_DrawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads)
+void ssd1306h_DrawCircleQuads(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t radius, uint8_t quads)
 {
   int16_t x = 0, y = radius;
   int16_t dp = 1 - radius;
@@ -603,62 +1155,179 @@ void ssd1306_DrawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t qua
       dp = dp + 2 * (++x) - 2 * (--y) + 5;
     if (quads & 0x1)
     {
-      ssd1306_DrawPixel(x0 + x, y0 - y);
-      ssd1306_DrawPixel(x0 + y, y0 - x);
+      ssd1306h_DrawPixel(dev, x0 + x, y0 - y);
+      ssd1306h_DrawPixel(dev, x0 + y, y0 - x);
     }
     if (quads & 0x2)
     {
-      ssd1306_DrawPixel(x0 - y, y0 - x);
-      ssd1306_DrawPixel(x0 - x, y0 - y);
+      ssd1306h_DrawPixel(dev, x0 - y, y0 - x);
+      ssd1306h_DrawPixel(dev, x0 - x, y0 - y);
     }
     if (quads & 0x4)
     {
-      ssd1306_DrawPixel(x0 - y, y0 + x);
-      ssd1306_DrawPixel(x0 - x, y0 + y);
+      ssd1306h_DrawPixel(dev, x0 - y, y0 + x);
+      ssd1306h_DrawPixel(dev, x0 - x, y0 + y);
     }
     if (quads & 0x8)
     {
-      ssd1306_DrawPixel(x0 + x, y0 + y);
-      ssd1306_DrawPixel(x0 + y, y0 + x);
+      ssd1306h_DrawPixel(dev, x0 + x, y0 + y);
+      ssd1306h_DrawPixel(dev, x0 + y, y0 + x);
     }
   }
   if (quads & 0x1 && quads & 0x8)
   {
-    ssd1306_DrawPixel(x0 + radius, y0);
+    ssd1306h_DrawPixel(dev, x0 + radius, y0);
   }
   if (quads & 0x4 && quads & 0x8)
   {
-    ssd1306_DrawPixel(x0, y0 + radius);
+    ssd1306h_DrawPixel(dev, x0, y0 + radius);
   }
   if (quads & 0x2 && quads & 0x4)
   {
-    ssd1306_DrawPixel(x0 - radius, y0);
+    ssd1306h_DrawPixel(dev, x0 - radius, y0);
   }
   if (quads & 0x1 && quads & 0x2)
   {
-    ssd1306_DrawPixel(x0, y0 - radius);
+    ssd1306h_DrawPixel(dev, x0, y0 - radius);
   }
 }
 
-void ssd1306_DrawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress)
+//
+//  Progress bar: rounded frame (width + 1, height + 1 pixels) and a rounded
+//  bar inside it (every pixel is drawn once). The box and the bar length are
+//  the same as with the earlier midpoint circle ends, the ends are the rows
+//  of ssd1306h_FillRoundRect (a different cap shape).
+//
+void ssd1306h_DrawProgressBar(SSD1306_t *dev, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress)
 {
   uint16_t radius = height / 2;
-  uint16_t xRadius = x + radius;
-  uint16_t yRadius = y + radius;
-  uint16_t doubleRadius = 2 * radius;
-  uint16_t innerRadius = radius - 2;
+  uint16_t maxProgressWidth = (width - 2 * radius + 1) * progress / 100;
+
+  ssd1306h_SetColor(dev, White);
+  ssd1306h_DrawRoundRect(dev, x, y, width + 1, height + 1, radius);
+  ssd1306h_FillRoundRect(dev, x + 2, y + 2, maxProgressWidth + 2 * radius - 3, height - 3, radius - 2);
+}
+
+//
+//  Clip rectangle: the drawing functions draw only inside it
+//
+void ssd1306h_SetClipRect(SSD1306_t *dev, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  int16_t x1 = x + w;
+  int16_t y1 = y + h;
+
+  if (x < 0) x = 0;
+  if (y < 0) y = 0;
+  if (x1 > SSD1306_WIDTH) x1 = SSD1306_WIDTH;
+  if (y1 > dev->Height) y1 = dev->Height;
+  if (x1 < x) x1 = x;
+  if (y1 < y) y1 = y;
+  dev->Clip[0] = x;
+  dev->Clip[1] = y;
+  dev->Clip[2] = x1;
+  dev->Clip[3] = y1;
+}
+
+void ssd1306h_ResetClipRect(SSD1306_t *dev)
+{
+  ssd1306h_SetClipRect(dev, 0, 0, SSD1306_WIDTH, dev->Height);
+}
+
+//
+//  Blit: draw a bitmap of the page format (one byte per 8 vertical pixels,
+//  LSB top, w bytes per 8-row page of the bitmap) with a raster operation,
+//  clipped by the clip rectangle, at any x, y.
+//  A byte of a screenbuffer page is made of two bitmap bytes (the bitmap page
+//  and the one above, shifted by y % 8), 4 columns are merged in a 32-bit word:
+//    r = (d & A) ^ B        d = (d & ~m) | (r & m)
+//  A, B are the source or constants by the operation, m is the mask of the
+//  drawn rows.
+//
+
+typedef struct {
+  uint32_t Invert;          // xor of the source
+  uint32_t AndKeep;         // A = (s & AndKeep) ^ AndInvert
+  uint32_t AndInvert;
+  uint32_t XorKeep;         // B = s & XorKeep
+} ssd1306_Rop;
+
+static inline uint32_t ssd1306_RopMerge(uint32_t d, uint32_t s, uint32_t m, const ssd1306_Rop *rop)
+{
+  s ^= rop->Invert;
+  return (d & ~m) | (((d & ((s & rop->AndKeep) ^ rop->AndInvert)) ^ (s & rop->XorKeep)) & m);
+}
 
-  ssd1306_SetColor(White);
-  ssd1306_DrawCircleQuads(xRadius, yRadius, radius, 0x06 /*0b00000110*/);
-  ssd1306_DrawHorizontalLine(xRadius, y, width - doubleRadius + 1);
-  ssd1306_DrawHorizontalLine(xRadius, y + height, width - doubleRadius + 1);
-  ssd1306_DrawCircleQuads(x + width - radius, yRadius, radius, 0x09 /*0b00001001*/);
+void ssd1306h_Blit(SSD1306_t *dev, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *src, uint8_t op)
+{
+  int16_t x0 = (x > dev->Clip[0]) ? x : dev->Clip[0];
+  int16_t y0 = (y > dev->Clip[1]) ? y : dev->Clip[1];
+  int16_t x1 = ((x + w < dev->Clip[2]) ? x + w : dev->Clip[2]) - 1;
+  int16_t y1 = ((y + h < dev->Clip[3]) ? y + h : dev->Clip[3]) - 1;
+  uint8_t shift = y & 7;
+  int16_t top = (y - shift) / 8;   /* screen page of the first bitmap page */
+  uint16_t pages = (h + 7) / 8;
+  uint32_t lomask = SSD1306_BYTES4(0xFF << shift);
+  uint32_t himask = SSD1306_BYTES4(0xFF >> (8 - shift));
+  uint16_t n, j, k;
+  uint8_t page, first, last;
+  const uint8_t *lo, *hi;
+  uint8_t *d;
+  uint32_t s, m;
+  ssd1306_Rop rop;
+  SSD1306_COLOR color = ssd1306_DrawColor(dev);
+
+  if (x0 > x1 || y0 > y1)
+    return;
 
-  uint16_t maxProgressWidth = (width - doubleRadius + 1) * progress / 100;
+  // The color of the transparent blit: OR, AND of the inverted source or XOR
+  rop.Invert = (op & BLIT_INVERT) ? 0xFFFFFFFF : 0;
+  op &= 0x07;
+  if (op == BLIT_TRANSPARENT)
+  {
+    op = (color == White) ? BLIT_OR : (color == Black) ? BLIT_AND : BLIT_XOR;
+    if (color == Black)
+      rop.Invert = ~rop.Invert;
+  }
+  switch (op)
+  {
+    case BLIT_COPY: rop.AndKeep = 0;          rop.AndInvert = 0;          rop.XorKeep = 0xFFFFFFFF; break;
+    case BLIT_OR:   rop.AndKeep = 0xFFFFFFFF; rop.AndInvert = 0xFFFFFFFF; rop.XorKeep = 0xFFFFFFFF; break;
+    case BLIT_AND:  rop.AndKeep = 0xFFFFFFFF; rop.AndInvert = 0;          rop.XorKeep = 0;          break;
+    default:        rop.AndKeep = 0;          rop.AndInvert = 0xFFFFFFFF; rop.XorKeep = 0xFFFFFFFF; break;
+  }
 
-  ssd1306_FillCircle(xRadius, yRadius, innerRadius);
-  ssd1306_FillRect(xRadius + 1, y + 2, maxProgressWidth, height - 3);
-  ssd1306_FillCircle(xRadius + maxProgressWidth, yRadius, innerRadius);
+  n = x1 - x0 + 1;
+  src += x0 - x;
+  for (page = y0 >> 3; page <= (y1 >> 3); page++)
+  {
+    k = page - top;
+    lo = (k < pages) ? src + k * w : NULL;
+    hi = (k > 0 && shift) ? src + (k - 1) * w : NULL;
+    first = (y0 > page * 8) ? y0 - page * 8 : 0;
+    last = (y1 < page * 8 + 7) ? y1 - page * 8 : 7;
+    m = SSD1306_BYTES4((0xFF << first) & (0xFF >> (7 - last)));
+    d = &dev->Buffer[SSD1306_WIDTH * page + x0];
+
+    for (j = 0; j + 4 <= n; j += 4)
+    {
+      s = 0;
+      if (lo != NULL)
+        s = (ssd1306_Load32(lo + j) << shift) & lomask;
+      if (hi != NULL)
+        s |= (ssd1306_Load32(hi + j) >> (8 - shift)) & himask;
+      ssd1306_Store32(d + j, ssd1306_RopMerge(ssd1306_Load32(d + j), s, m, &rop));
+    }
+    for (; j < n; j++)
+    {
+      s = 0;
+      if (lo != NULL)
+        s = (lo[j] << shift) & 0xFF;
+      if (hi != NULL)
+        s |= hi[j] >> (8 - shift);
+      d[j] = ssd1306_RopMerge(d[j], s, m, &rop);
+    }
+  }
+  ssd1306_MarkDirty(dev, x0, y0, x1, y1);
 }
 
 // Draw monochrome bitmap
@@ -669,345 +1338,2062 @@ void ssd1306_DrawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t he
 // note: each '1' bit in the bitmap will be drawn as a pixel
 //       each '0' bit in the will not be drawn (transparent bitmap)
 // bitmap: one byte per 8 vertical pixels, LSB top, truncate bottom bits
-void ssd1306_DrawBitmap(uint8_t X, uint8_t Y, uint8_t W, uint8_t H, const uint8_t* pBMP)
+void ssd1306h_DrawBitmap(SSD1306_t *dev, uint8_t X, uint8_t Y, uint8_t W, uint8_t H, const uint8_t* pBMP)
+{
+  ssd1306h_Blit(dev, X, Y, W, H, pBMP, BLIT_TRANSPARENT);
+}
+
+//
+//  Draw the image (the same format as DrawBitmap) where the mask is 1: the
+//  mask area is cleared, then the image is ORed (the image is inside the mask)
+//
+void ssd1306h_DrawMaskedBitmap(SSD1306_t *dev, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *image, const uint8_t *mask)
+{
+  ssd1306h_Blit(dev, x, y, w, h, mask, BLIT_AND | BLIT_INVERT);
+  ssd1306h_Blit(dev, x, y, w, h, image, BLIT_OR);
+}
+
+//
+//  Compressed bitmap (made by Tools/image/imgpack.c): width, height, then the
+//  tokens of the page format bytes (page by page, column by column), a token
+//  can go on in the next page:
+//    00nnnnnn b...   n + 1 literal bytes
+//    01nnnnnn b      n + 2 times the byte b
+//    10nnnnnn d      n + 3 bytes copied from d + 1 bytes back (from the last 256 bytes)
+//    11nnnnnn        n + 1 zero bytes
+//  The bytes are decoded into a 256-byte window (no full size buffer), every
+//  finished page of the bitmap is blitted from the window with the raster
+//  operation (clip rectangle, any x, y).
+//
+static void ssd1306_BlitWindow(SSD1306_t *dev, int16_t x, int16_t y, uint8_t w, uint8_t h, const uint8_t *window, uint8_t start, uint8_t op)
+{
+  uint16_t n = 256 - start; /* the page can wrap around the end of the window */
+
+  if (n >= w)
+    ssd1306h_Blit(dev, x, y, w, h, &window[start], op);
+  else
+  {
+    ssd1306h_Blit(dev, x, y, n, h, &window[start], op);
+    ssd1306h_Blit(dev, x + n, y, w - n, h, window, op);
+  }
+}
+
+void ssd1306h_DrawCompressedBitmap(SSD1306_t *dev, int16_t x, int16_t y, const uint8_t *data, uint8_t op)
 {
-  uint8_t pX;
-  uint8_t pY;
-  uint8_t tmpCh;
-  uint8_t bL;
+  uint8_t window[256];
+  uint8_t w = data[0], h = data[1];
+  uint8_t pos = 0, start = 0;   /* write position, start of the page in the window */
+  uint8_t col = 0, page = 0;
+  uint8_t t, n, m, b = 0, from = 0;
 
-  pY = Y;
-  while (pY < Y + H)
+  if (w == 0 || h == 0)
+    return;
+  data += 2;
+  while (1)
   {
-    pX = X;
-    while (pX < X + W)
+    t = *data++;
+    n = (t & 0x3F) + 1;
+    switch (t >> 6)
+    {
+      case 1: n++; b = *data++; break;
+      case 2: n += 2; from = pos - *data++ - 1; break;
+      case 3: b = 0; break;
+    }
+    while (n)
     {
-      bL = 0;
-      tmpCh = *pBMP++;
-      if (tmpCh)
+      m = (n < w - col) ? n : w - col;
+      n -= m;
+      col += m;
+      switch (t >> 6)
       {
-        while (bL < 8)
-        {
-          if (tmpCh & 0x01) ssd1306_DrawPixel(pX,pY + bL);
-          tmpCh >>= 1;
-          if (tmpCh)
-          {
-            bL++;
-          }
-          else
-          {
-            pX++;
-            break;
-          }
-        }
+        case 0: while (m--) window[pos++] = *data++; break;
+        case 2: while (m--) window[pos++] = window[from++]; break;
+        default: while (m--) window[pos++] = b; break;
       }
-      else
-      {
-        pX++;
+      if (col == w)
+      { /* the page is finished */
+        ssd1306_BlitWindow(dev, x, y + 8 * page, w, (h - 8 * page < 8) ? h - 8 * page : 8, window, start, op);
+        if (++page >= (h + 7) >> 3)
+          return;
+        start = pos;
+        col = 0;
       }
     }
-    pY += 8;
   }
 }
 
-char ssd1306_WriteChar(char ch, FontDef Font)
+//
+//  Glyph of the code point in a packed font: binary search over the ranges
+//  (sorted by code point), NULL: the font has no glyph
+//
+static const FontGlyph *ssd1306_FindGlyph(const FontPacked *f, uint32_t cp)
 {
-  uint32_t i, b, j;
+  const FontRange *r;
+  uint16_t lo = 0, hi = f->ranges, mid;
 
-  // Check remaining space on current line
-  if (width() <= (SSD1306.CurrentX + Font.FontWidth) ||
-    height() <= (SSD1306.CurrentY + Font.FontHeight))
+  while (lo < hi)
   {
-    // Not enough space on current line
+    mid = (lo + hi) >> 1;
+    r = &f->range[mid];
+    if (cp < r->first)
+      hi = mid;
+    else if (cp - r->first >= r->count)
+      lo = mid + 1;
+    else
+      return &f->glyphs[r->glyph + (cp - r->first)];
+  }
+  return NULL;
+}
+
+//
+//  Pen step of the code point, 0: the font has no glyph (the row and the
+//  page-major fonts have only ' ' .. '~')
+//
+static uint8_t ssd1306_GlyphAdvance(const FontDef *Font, uint32_t cp)
+{
+  const FontGlyph *g;
+
+  if (Font->packed != NULL)
+  {
+    g = ssd1306_FindGlyph(Font->packed, cp);
+    return (g != NULL) ? g->advance : 0;
+  }
+  return (cp >= ' ' && cp <= '~') ? Font->FontWidth : 0;
+}
+
+//
+//  Decode the next char of an UTF-8 string, the pointer goes behind it.
+//  An invalid sequence (overlong, surrogate, above U+10FFFF, a missing or a
+//  lone continuation byte) gives SSD1306_BADCHAR and skips one byte.
+//
+#define SSD1306_BADCHAR   0xFFFFFFFF
+#define ssd1306_Utf8Length(b)  (((uint8_t)(b) < 0xC0) ? 1 : ((uint8_t)(b) < 0xE0) ? 2 : ((uint8_t)(b) < 0xF0) ? 3 : 4)
+
+static uint32_t ssd1306_Utf8Next(const char **str)
+{
+  const uint8_t *s = (const uint8_t *)*str;
+  uint32_t cp;
+  uint8_t n, i;
+
+  if (s[0] < 0x80)
+  {
+    (*str)++;
+    return s[0];
+  }
+  if (s[0] < 0xC2 || s[0] > 0xF4)
+  { /* continuation byte, overlong 2 byte lead, above U+10FFFF */
+    (*str)++;
+    return SSD1306_BADCHAR;
+  }
+  n = ssd1306_Utf8Length(s[0]) - 1;
+  cp = s[0] & (0x3F >> n);
+  for (i = 1; i <= n; i++)
+  { /* the terminating 0 is not a continuation byte */
+    if ((s[i] & 0xC0) != 0x80)
+    {
+      (*str)++;
+      return SSD1306_BADCHAR;
+    }
+    cp = (cp << 6) | (s[i] & 0x3F);
+  }
+  if ((n == 2 && cp < 0x800) || (n == 3 && (cp < 0x10000 || cp > 0x10FFFF)) || (cp >= 0xD800 && cp <= 0xDFFF))
+  {
+    (*str)++;
+    return SSD1306_BADCHAR;
+  }
+  *str += n + 1;
+  return cp;
+}
+
+//
+//  Draw the glyph of the code point at x, y (the clip rectangle cuts it)
+//  Packed proportional font: the columns of the glyph box are read from the
+//  bit stream into the page format cell (advance x FontHeight), then the cell
+//  is blitted as the page-major glyphs (with the background)
+//  returns the pen step, 0: no glyph
+//
+static uint8_t ssd1306_DrawGlyph(SSD1306_t *dev, int16_t x, int16_t y, uint32_t cp, const FontDef *Font)
+{
+  const FontGlyph *g;
+  const uint8_t *bits;
+  uint8_t cell[4 * 32];
+  uint8_t pages = (Font->FontHeight + 7) >> 3;
+  uint8_t c, p, n;
+  uint64_t acc = 0;
+  uint32_t col, i, b, j;
+  int16_t px, py;
+  SSD1306_COLOR color = dev->Color;
+  SSD1306_COLOR glyphcolor = ssd1306_DrawColor(dev);
+  uint8_t op = (glyphcolor == White) ? BLIT_COPY : (glyphcolor == Black) ? (BLIT_COPY | BLIT_INVERT) : BLIT_XOR;
+
+  if (Font->packed != NULL)
+  {
+    g = ssd1306_FindGlyph(Font->packed, cp);
+    if (g == NULL)
+      return 0;
+    memset(cell, 0, g->advance * pages);
+    bits = &Font->packed->bits[g->offset];
+    n = 0;
+    for (c = 0; c < g->width; c++)
+    {
+      while (n < g->height)
+      { /* LSB first: the next byte goes above the bits in the accumulator */
+        acc |= (uint64_t)*bits++ << n;
+        n += 8;
+      }
+      col = (uint32_t)(acc & ((1ULL << g->height) - 1)) << g->yoffset;
+      acc >>= g->height;
+      n -= g->height;
+      for (p = 0; p < pages; p++)
+        cell[p * g->advance + g->xoffset + c] = col >> (8 * p);
+    }
+    ssd1306h_Blit(dev, x, y, g->advance, Font->FontHeight, cell, op);
+    return g->advance;
+  }
+
+  // The row and the page-major fonts have ' ' .. '~'
+  if (cp < ' ' || cp > '~')
     return 0;
+
+  // Page-major font: blit of the glyph with its background (Inverse: the
+  // glyph is inverted on the background)
+  if (Font->pages != NULL)
+  {
+    ssd1306h_Blit(dev, x, y, Font->FontWidth, Font->FontHeight,
+                  &Font->pages[(cp - ' ') * Font->FontWidth * pages], op);
+    return Font->FontWidth;
   }
 
   // Use the font to write
-  for (i = 0; i < Font.FontHeight; i++)
+  for (i = 0; i < Font->FontHeight; i++)
   {
-    b = Font.data[(ch - 32) * Font.FontHeight + i];
-    for (j = 0; j < Font.FontWidth; j++)
+    b = Font->data[(cp - 32) * Font->FontHeight + i];
+    py = y + i;
+    for (j = 0; j < Font->FontWidth; j++)
     {
+      px = x + j;
+      if (px < dev->Clip[0] || px >= dev->Clip[2] || py < dev->Clip[1] || py >= dev->Clip[3])
+        continue;
       if ((b << j) & 0x8000)
       {
-        ssd1306_DrawPixel(SSD1306.CurrentX + j, SSD1306.CurrentY + i);
+        ssd1306h_DrawPixel(dev, px, py);
       }
-      else
+      else if (color != Inverse)
       {
-        SSD1306.Color = !SSD1306.Color;
-        ssd1306_DrawPixel(SSD1306.CurrentX + j, SSD1306.CurrentY + i);
-        SSD1306.Color = !SSD1306.Color;
+        dev->Color = (SSD1306_COLOR) !color;
+        ssd1306h_DrawPixel(dev, px, py);
+        dev->Color = color;
       }
     }
   }
+  return Font->FontWidth;
+}
+
+//
+//  Write the char of a Unicode code point
+//  returns the code point, 0: not written (no glyph in the font, or no space
+//  left on the line)
+//
+uint32_t ssd1306h_WriteCodePoint(SSD1306_t *dev, uint32_t cp, FontDef Font)
+{
+  uint8_t advance = ssd1306_GlyphAdvance(&Font, cp);
+
+  // Check remaining space on current line
+  if (advance == 0 || SSD1306_WIDTH < (dev->CurrentX + advance) ||
+    dev->Height < (dev->CurrentY + Font.FontHeight))
+  {
+    // Not enough space on current line
+    return 0;
+  }
+
+  ssd1306_DrawGlyph(dev, dev->CurrentX, dev->CurrentY, cp, &Font);
 
   // The current space is now taken
-  SSD1306.CurrentX += Font.FontWidth;
+  dev->CurrentX += advance;
 
   // Return written char for validation
-  return ch;
+  return cp;
 }
 
 //
-//  Write full string to screenbuffer
+//  Write a char (the code points 0 .. 255: Latin-1)
 //
-char ssd1306_WriteString(char* str, FontDef Font)
+char ssd1306h_WriteChar(SSD1306_t *dev, char ch, FontDef Font)
 {
+  return (ssd1306h_WriteCodePoint(dev, (uint8_t)ch, Font) != 0) ? ch : 0;
+}
+
+//
+//  Write full string to screenbuffer (UTF-8)
+//  returns 0: everything written, else the first byte of the char that could
+//  not be written (invalid UTF-8, no glyph, or no space left on the line)
+//
+char ssd1306h_WriteString(SSD1306_t *dev, char* str, FontDef Font)
+{
+  const char *s = str;
+  uint32_t cp;
+
   // Write until null-byte
-  while (*str)
+  while (*s)
   {
-    if (ssd1306_WriteChar(*str, Font) != *str)
+    str = (char *)s;
+    cp = ssd1306_Utf8Next(&s);
+    if (cp == SSD1306_BADCHAR || ssd1306h_WriteCodePoint(dev, cp, Font) != cp)
     {
       // Char could not be written
       return *str;
     }
-
-    // Next char
-    str++;
   }
 
   // Everything ok
-  return *str;
+  return *s;
 }
 
 //
-//  Position the cursor
+//  Text layout
+//  The text (UTF-8) is measured with the advances of the glyphs, so the lines
+//  can be broken, aligned and justified before they are drawn. The chars
+//  without a glyph are skipped (0 pixels).
 //
-void ssd1306_SetCursor(uint8_t x, uint8_t y)
-{
-  SSD1306.CurrentX = x;
-  SSD1306.CurrentY = y;
-}
-
-void ssd1306_Clear()
-{
-  memset(SSD1306_Buffer, 0, SSD1306_BUFFER_SIZE);
-}
-
-#if SSD1306_USE_DMA == 0
 
 //
-//  Send a byte to the command register
+//  Width of the text in pixels (more lines: the widest line)
 //
-void ssd1306_WriteCommand(uint8_t command)
+uint16_t ssd1306_TextWidth(const char *str, FontDef Font)
 {
-  HAL_I2C_Mem_Write(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &command, 1, 10);
-}
+  uint16_t width = 0, max = 0;
 
-void ssd1306_WriteData(uint8_t* data, uint16_t size)
-{
-  HAL_I2C_Mem_Write(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x40, 1, data, size, 100);
+  while (*str)
+  {
+    if (*str == '\n')
+    {
+      str++;
+      width = 0;
+      continue;
+    }
+    width += ssd1306_GlyphAdvance(&Font, ssd1306_Utf8Next(&str));
+    if (width > max)
+      max = width;
+  }
+  return max;
 }
 
 //
-//  Write the screenbuffer with changed to the screen
+//  Break the next line of the text for the width: at the last space that
+//  fits (the spaces at the break are dropped), at '\n', or in a word longer
+//  than the width (at least one char goes on a line)
+//  returns 0: end of the text (no line)
 //
-void ssd1306_UpdateScreen(void)
+uint8_t ssd1306_TextBreak(const char *str, uint16_t width, FontDef Font, SSD1306_TextLine *line)
 {
-  uint8_t i;
-  for (i = 0; i < SSD1306_HEIGHT / 8; i++)
+  const char *s = str, *p, *end = str, *brk = NULL;
+  uint16_t x = 0, endwidth = 0, brkwidth = 0;
+  uint8_t spaces = 0, endspaces = 0, brkspaces = 0, advance;
+  uint32_t cp;
+
+  if (*str == 0)
+    return 0;
+  line->Start = str;
+  line->Last = 1;
+  while (*s && *s != '\n')
   {
-    ssd1306_WriteCommand(0xB0 + i);
-    ssd1306_WriteCommand(SETLOWCOLUMN);
-    ssd1306_WriteCommand(SETHIGHCOLUMN);
-    ssd1306_WriteData(&SSD1306_Buffer[SSD1306_WIDTH * i], width());
+    p = s;
+    cp = ssd1306_Utf8Next(&p);
+    advance = ssd1306_GlyphAdvance(&Font, cp);
+    if (cp == ' ')
+    {
+      if (end == s && end != str)
+      { /* the first space after a word: a break */
+        brk = end;
+        brkwidth = endwidth;
+        brkspaces = endspaces;
+      }
+      spaces++;
+    }
+    else
+    {
+      if (x + advance > width && s != str)
+      {
+        line->Last = 0;
+        if (brk != NULL)
+        { /* at the space before the word */
+          end = brk;
+          endwidth = brkwidth;
+          endspaces = brkspaces;
+          for (s = brk; *s == ' '; s++) { }
+        }
+        break;
+      }
+      end = p;
+      endwidth = x + advance;
+      endspaces = spaces;
+    }
+    x += advance;
+    s = p;
   }
+  if (*s == '\n' && line->Last)
+    s++;
+  line->Length = end - str;
+  line->Width = endwidth;
+  line->Spaces = endspaces;
+  line->Next = s;
+  return 1;
 }
 
-#elif SSD1306_USE_DMA == 1
-
-volatile uint8_t ssd1306_updatestatus = 0;
-volatile uint8_t ssd1306_updateend;
-uint8_t i2c_command = 0;
-
-#if SSD1306_CONTUPDATE == 0
-
 //
-//  Send a byte to the command register
+//  Number of lines of the text broken for the width
 //
-void ssd1306_WriteCommand(uint8_t command)
+uint16_t ssd1306_TextLines(const char *str, uint16_t width, FontDef Font)
 {
-  while(ssd1306_updatestatus);
-  while(HAL_I2C_GetState(&SSD1306_I2C_PORT) != HAL_I2C_STATE_READY) { };
-  i2c_command = command;
-  HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &i2c_command, 1);
+  SSD1306_TextLine line;
+  uint16_t n = 0;
+
+  while (ssd1306_TextBreak(str, width, Font, &line))
+  {
+    str = line.Next;
+    n++;
+  }
+  return n;
 }
 
 //
-//  Write the screenbuffer with changed to the screen
+//  Draw the text in the box: the lines are broken for the box width (not
+//  with TEXT_NOWRAP) and aligned (TEXT_ALIGN_..., TEXT_JUSTIFY,
+//  TEXT_VALIGN_...), the box cuts the chars partly outside of it. The chars
+//  are drawn with their background, the rest of the box is not cleared.
+//  returns the bytes of the text on the lines that are completely in the box
+//  (the rest starts there, e.g. the next page of the text)
 //
-void ssd1306_UpdateScreen(void)
+uint16_t ssd1306h_DrawText(SSD1306_t *dev, int16_t x, int16_t y, int16_t w, int16_t h, const char *str, FontDef Font, uint8_t flags)
 {
-  if(ssd1306_updatestatus == 0)
-  {
-    ssd1306_updatestatus = SSD1306_HEIGHT;
-    ssd1306_updateend = SSD1306_HEIGHT + (SSD1306_HEIGHT / 2);
-    i2c_command = 0xB0;
-    HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &i2c_command, 1);
-  }
-  else if(ssd1306_updatestatus >= SSD1306_HEIGHT)
+  SSD1306_TextLine line;
+  const char *text = str, *s, *shown = NULL;
+  uint8_t clip[4];
+  int16_t box[4], px, py = y, lines;
+  uint16_t width = (flags & TEXT_NOWRAP) ? 0xFFFF : (w > 0) ? w : 0;
+  uint16_t gap, extra;
+  uint8_t align = flags & 0x03;
+  uint32_t cp;
+
+  // The clip rectangle: the box in the clip rectangle
+  memcpy(clip, dev->Clip, sizeof(clip));
+  box[0] = (x > clip[0]) ? x : clip[0];
+  box[1] = (y > clip[1]) ? y : clip[1];
+  box[2] = (x + w < clip[2]) ? x + w : clip[2];
+  box[3] = (y + h < clip[3]) ? y + h : clip[3];
+  ssd1306h_SetClipRect(dev, box[0], box[1], box[2] - box[0], box[3] - box[1]);
+
+  if (flags & (TEXT_VALIGN_MIDDLE | TEXT_VALIGN_BOTTOM))
   {
-    ssd1306_updatestatus -= (SSD1306_HEIGHT / 2);
-    ssd1306_updateend = (ssd1306_updatestatus + (SSD1306_HEIGHT / 2 + 1)) & 0xFC;
+    lines = h - (int16_t)ssd1306_TextLines(str, width, Font) * Font.FontHeight;
+    if (lines > 0)
+      py += (flags & TEXT_VALIGN_MIDDLE) ? lines / 2 : lines;
   }
-}
-
-char ssd1306_UpdateScreenCompleted(void)
-{
-  if(ssd1306_updatestatus)
-    return 0;
-  else
-    return 1;
-}
-
-__weak void ssd1306_UpdateCompletedCallback(void) { };
 
-void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
-{
-  uint32_t phase;
-  if(hi2c->Instance == SSD1306_I2C_PORT.Instance)
+  for (; py < y + h && ssd1306_TextBreak(str, width, Font, &line); str = line.Next, py += Font.FontHeight)
   {
-    if(ssd1306_updatestatus)
+    if (py + Font.FontHeight > y + h && shown == NULL)
+      shown = str;
+    px = x;
+    gap = 0;
+    extra = 0;
+    if (align == TEXT_ALIGN_RIGHT)
+      px += w - line.Width;
+    else if (align == TEXT_ALIGN_CENTER)
+      px += (w - (int16_t)line.Width) / 2;
+    else if (align == TEXT_JUSTIFY && !line.Last && line.Spaces && line.Width < w)
+    { /* the extra pixels go to the spaces, the first ones get one more */
+      gap = (w - line.Width) / line.Spaces;
+      extra = (w - line.Width) % line.Spaces;
+    }
+    for (s = str; s < str + line.Length; )
     {
-      if(ssd1306_updatestatus < ssd1306_updateend)
+      cp = ssd1306_Utf8Next(&s);
+      px += ssd1306_DrawGlyph(dev, px, py, cp, &Font);
+      if (cp == ' ' && gap)
       {
-        ssd1306_updatestatus++;
-        phase = ssd1306_updatestatus & 3;
-        if(phase == 3)
-          HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x40, 1, &SSD1306_Buffer[SSD1306_WIDTH * ((ssd1306_updatestatus >> 2) & (SSD1306_HEIGHT / 8 - 1))], width());
-        else
+        px += gap;
+        if (extra)
         {
-          if(phase == 0)
-            i2c_command = 0xB0 + ((ssd1306_updatestatus >> 2) & (SSD1306_HEIGHT / 8 - 1));
-          else if(phase == 1)
-            i2c_command = SETLOWCOLUMN;
-          else if(phase == 2)
-            i2c_command = SETHIGHCOLUMN;
-          HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &i2c_command, 1);
+          px++;
+          extra--;
         }
       }
-      else
-      {
-        ssd1306_updatestatus = 0;
-        ssd1306_UpdateCompletedCallback();
-      }
     }
   }
+
+  memcpy(dev->Clip, clip, sizeof(clip));
+  return ((shown != NULL) ? shown : str) - text;
 }
 
-#elif SSD1306_CONTUPDATE == 1
+//
+//  Position the cursor
+//
+void ssd1306h_SetCursor(SSD1306_t *dev, uint8_t x, uint8_t y)
+{
+  dev->CurrentX = x;
+  dev->CurrentY = y;
+}
+
+void ssd1306h_Clear(SSD1306_t *dev)
+{
+  memset(dev->Buffer, 0, SSD1306_WIDTH * dev->Pages);
+  dev->StartLine = 0;
+  ssd1306_MarkDirty(dev, 0, 0, SSD1306_WIDTH - 1, dev->Height - 1);
+}
+
+//
+//  Text console
+//  The lines are written with WriteChar. A new line at the bottom of the
+//  64-line display rotates the display start line by one line, so only the
+//  pages of the new line are sent (one page with an 8-row font). The other
+//  displays move the screenbuffer up (the whole screen is sent).
+//  The console works in the display memory: the other drawing functions see
+//  the rotated memory, ssd1306_Clear sets the start line back.
+//
 
-volatile uint8_t ssd1306_command = 0;
-volatile uint8_t ssd1306_ContUpdate = 0;
-volatile uint8_t ssd1306_RasterIntRegs = 0;
+// Background of the console (the text is drawn with the color)
+#define ssd1306_ConsoleBackground(dev)  (((dev)->Color == Black) ? 0xFF : 0x00)
 
 //
-//  Send a byte to the command register
+//  Scroll the console up by one line and clear the last line
 //
-void ssd1306_WriteCommand(uint8_t command)
+static void ssd1306_ConsoleScroll(SSD1306_t *dev)
 {
-  if(ssd1306_updatestatus)
+  uint8_t y, page;
+  uint8_t lh = dev->ConsoleLineHeight;
+  uint8_t last = (dev->ConsoleLines - 1) * lh; /* screen row of the last line */
+
+  if (dev->Height == 64)
+  { /* the display memory rows wrap around at 64 as the start line rotates */
+    dev->StartLine = (dev->StartLine + lh) & 63;
+    for (y = last; y < dev->Height; y += 8)
+    {
+      page = ((dev->StartLine + y) & 63) >> 3;
+      memset(&dev->Buffer[SSD1306_WIDTH * page], ssd1306_ConsoleBackground(dev), SSD1306_WIDTH);
+      ssd1306_MarkDirty(dev, 0, page << 3, SSD1306_WIDTH - 1, (page << 3) + 7);
+    }
+  }
+  else
   {
-    while(ssd1306_command);
-    ssd1306_command = command;
+    memmove(dev->Buffer, &dev->Buffer[SSD1306_WIDTH * (lh >> 3)], SSD1306_WIDTH * (last >> 3));
+    memset(&dev->Buffer[SSD1306_WIDTH * (last >> 3)], ssd1306_ConsoleBackground(dev), SSD1306_WIDTH * (dev->Pages - (last >> 3)));
+    ssd1306_MarkDirty(dev, 0, 0, SSD1306_WIDTH - 1, dev->Height - 1);
+  }
+}
+
+static void ssd1306_ConsoleNewLine(SSD1306_t *dev)
+{
+  dev->ConsoleX = 0;
+  dev->ConsoleNewLine = 0;
+  if (dev->ConsoleLine + 1 < dev->ConsoleLines)
+    dev->ConsoleLine++;
+  else
+    ssd1306_ConsoleScroll(dev);
+}
+
+//
+//  Clear the screen, the cursor goes to the top left corner
+//
+void ssd1306h_ConsoleClear(SSD1306_t *dev)
+{
+  memset(dev->Buffer, ssd1306_ConsoleBackground(dev), SSD1306_WIDTH * dev->Pages);
+  dev->StartLine = 0;
+  ssd1306_MarkDirty(dev, 0, 0, SSD1306_WIDTH - 1, dev->Height - 1);
+  dev->ConsoleLine = 0;
+  dev->ConsoleX = 0;
+  dev->ConsoleNewLine = 0;
+  dev->ConsoleUtf8Len = 0;
+}
+
+//
+//  Start the console with the font (a line is 8, 16 or 32 rows: whole pages)
+//
+void ssd1306h_ConsoleInit(SSD1306_t *dev, FontDef Font)
+{
+  dev->ConsoleFont = Font.data;
+  dev->ConsoleFontPages = Font.pages;
+  dev->ConsoleFontPacked = Font.packed;
+  dev->ConsoleFontWidth = Font.FontWidth;
+  dev->ConsoleFontHeight = Font.FontHeight;
+  dev->ConsoleLineHeight = (Font.FontHeight <= 8) ? 8 : (Font.FontHeight <= 16) ? 16 : 32;
+  dev->ConsoleLines = dev->Height / dev->ConsoleLineHeight;
+  ssd1306h_ConsoleClear(dev);
+}
+
+//
+//  Write a char to the console
+//  '\n' starts a new line (when the next char comes, so the last line is used
+//  too), '\r' goes to the start of the line, a long line is wrapped.
+//
+void ssd1306h_ConsolePutChar(SSD1306_t *dev, char ch)
+{
+  FontDef font = {dev->ConsoleFontWidth, dev->ConsoleFontHeight, dev->ConsoleFont, dev->ConsoleFontPages, dev->ConsoleFontPacked};
+  const char *s = dev->ConsoleUtf8;
+  uint32_t cp = (uint8_t)ch;
+  uint8_t y;
+
+  if ((dev->ConsoleFont == NULL && dev->ConsoleFontPages == NULL && dev->ConsoleFontPacked == NULL) || dev->ConsoleLines == 0)
+    return;
+  if (cp >= 0x80)
+  { /* UTF-8: the bytes of the char are collected (a lone continuation byte is dropped) */
+    if ((cp & 0xC0) != 0x80)
+      dev->ConsoleUtf8Len = 0;
+    else if (dev->ConsoleUtf8Len == 0)
+      return;
+    dev->ConsoleUtf8[dev->ConsoleUtf8Len++] = ch;
+    if (dev->ConsoleUtf8Len < ssd1306_Utf8Length(dev->ConsoleUtf8[0]))
+      return;
+    dev->ConsoleUtf8Len = 0;
+    cp = ssd1306_Utf8Next(&s);
   }
   else
+    dev->ConsoleUtf8Len = 0;
+  if (ch == '\n')
   {
-    while(HAL_I2C_GetState(&SSD1306_I2C_PORT) != HAL_I2C_STATE_READY) { };
-    i2c_command = command;
-    HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &i2c_command, 1);
+    if (dev->ConsoleNewLine)
+      ssd1306_ConsoleNewLine(dev);
+    dev->ConsoleNewLine = 1;
+    return;
+  }
+  if (ch == '\r')
+  {
+    dev->ConsoleX = 0;
+    return;
   }
+  if (cp < ' ' || ssd1306_GlyphAdvance(&font, cp) == 0)
+    return;
+
+  if (dev->ConsoleNewLine || (dev->ConsoleX + dev->ConsoleFontWidth > SSD1306_WIDTH))
+    ssd1306_ConsoleNewLine(dev);
+  y = dev->ConsoleLine * dev->ConsoleLineHeight;
+  if (dev->Height == 64)
+    y = (dev->StartLine + y) & 63;
+  ssd1306h_SetCursor(dev, dev->ConsoleX, y);
+  ssd1306h_WriteCodePoint(dev, cp, font);
+  dev->ConsoleX += dev->ConsoleFontWidth;
 }
 
-void ssd1306_ContUpdateEnable(void)
+void ssd1306h_ConsoleWrite(SSD1306_t *dev, const char *str)
 {
-  if(!ssd1306_ContUpdate)
+  while (*str)
   {
-    while(HAL_I2C_GetState(&SSD1306_I2C_PORT) != HAL_I2C_STATE_READY) { };
-    ssd1306_updatestatus = SSD1306_HEIGHT;
-    ssd1306_updateend = SSD1306_HEIGHT + (SSD1306_HEIGHT / 2);
-    ssd1306_ContUpdate = 1;
-    i2c_command = 0xB0;
-    HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &i2c_command, 1);
+    ssd1306h_ConsolePutChar(dev, *str++);
   }
 }
 
-void ssd1306_ContUpdateDisable(void)
+//
+//  Retained widgets
+//  The widgets (container, label, value, bar, icon) are kept in a tree, every
+//  widget remembers its content. The setter functions mark a widget changed
+//  only if the content is different, and ssd1306_WidgetRender redraws only the
+//  changed widgets (in their own box): the screenbuffer changes only there, so
+//  the update sends only these column spans. A static screen costs nothing:
+//  the render returns at the root, the update sends nothing.
+//  The changed widgets mark their ancestors (WIDGET_CHILDDIRTY), the render
+//  goes down only into these subtrees.
+//
+
+//
+//  Mark the widget changed (it is redrawn with all of its children)
+//
+void ssd1306_WidgetInvalidate(SSD1306_Widget *w)
+{
+  w->Flags |= WIDGET_DIRTY;
+  for (w = w->Parent; w != NULL; w = w->Parent)
+    w->Flags |= WIDGET_CHILDDIRTY;
+}
+
+//
+//  Initialize a widget: position in the parent, size of its box
+//
+void ssd1306_WidgetInit(SSD1306_Widget *w, SSD1306_WidgetType type, int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+  memset(w, 0, sizeof(SSD1306_Widget));
+  w->Type = type;
+  w->Flags = WIDGET_DIRTY;
+  w->X = x;
+  w->Y = y;
+  w->Width = width;
+  w->Height = height;
+}
+
+//
+//  Add the widget to the end of the children of the parent (the children are
+//  drawn in this order, over the parent)
+//
+void ssd1306_WidgetAdd(SSD1306_Widget *parent, SSD1306_Widget *w)
+{
+  SSD1306_Widget **p = &parent->Child;
+  while (*p != NULL)
+    p = &(*p)->Next;
+  *p = w;
+  w->Next = NULL;
+  w->Parent = parent;
+  ssd1306_WidgetInvalidate(w);
+}
+
+//
+//  Set the style flags (WIDGET_HIDDEN, WIDGET_INVERT, WIDGET_BORDER, WIDGET_ALIGN_...)
+//
+void ssd1306_WidgetSetFlags(SSD1306_Widget *w, uint8_t flags)
+{
+  flags &= ~(WIDGET_DIRTY | WIDGET_CHILDDIRTY);
+  if ((w->Flags & ~(WIDGET_DIRTY | WIDGET_CHILDDIRTY)) == flags)
+    return;
+  w->Flags = (w->Flags & (WIDGET_DIRTY | WIDGET_CHILDDIRTY)) | flags;
+  ssd1306_WidgetInvalidate(w);
+}
+
+//
+//  Text of a label, unit after the number of a value (cut at SSD1306_WIDGET_TEXTSIZE - 1 chars)
+//
+void ssd1306_WidgetSetText(SSD1306_Widget *w, const char *text)
+{
+  if (strncmp(w->Text, text, SSD1306_WIDGET_TEXTSIZE - 1) == 0)
+    return;
+  strncpy(w->Text, text, SSD1306_WIDGET_TEXTSIZE - 1);
+  w->Text[SSD1306_WIDGET_TEXTSIZE - 1] = 0;
+  ssd1306_WidgetInvalidate(w);
+}
+
+void ssd1306_WidgetSetFont(SSD1306_Widget *w, const FontDef *font)
+{
+  if (w->Font == font)
+    return;
+  w->Font = font;
+  ssd1306_WidgetInvalidate(w);
+}
+
+//
+//  Value of a value widget, percent of a bar (0..100)
+//
+void ssd1306_WidgetSetValue(SSD1306_Widget *w, int32_t value)
+{
+  if (w->Type == WIDGET_BAR)
+    value = (value < 0) ? 0 : (value > 100) ? 100 : value;
+  if (w->Value == value)
+    return;
+  w->Value = value;
+  ssd1306_WidgetInvalidate(w);
+}
+
+//
+//  Digits after the decimal point of a value widget (the value is value / 10^decimals)
+//
+void ssd1306_WidgetSetDecimals(SSD1306_Widget *w, uint8_t decimals)
+{
+  if (decimals > 9)
+    decimals = 9;
+  if (w->Decimals == decimals)
+    return;
+  w->Decimals = decimals;
+  ssd1306_WidgetInvalidate(w);
+}
+
+//
+//  Bitmap of an icon (page format, the size of the widget)
+//
+void ssd1306_WidgetSetBitmap(SSD1306_Widget *w, const uint8_t *bitmap)
+{
+  if (w->Bitmap == bitmap)
+    return;
+  w->Bitmap = bitmap;
+  ssd1306_WidgetInvalidate(w);
+}
+
+//
+//  Text of a value widget: the number with the decimal point and the unit
+//
+static void ssd1306_WidgetFormat(const SSD1306_Widget *w, char *s)
 {
-  if(ssd1306_ContUpdate)
+  char digits[11];
+  uint32_t v = (w->Value < 0) ? 0 - (uint32_t)w->Value : (uint32_t)w->Value;
+  uint8_t n = 0;
+
+  do
+  {
+    digits[n++] = '0' + v % 10;
+    v /= 10;
+  } while (v || n <= w->Decimals);
+  if (w->Value < 0)
+    *s++ = '-';
+  while (n)
   {
-    ssd1306_ContUpdate = 0;
-    while(ssd1306_updatestatus) { };
+    if (n-- == w->Decimals)
+      *s++ = '.';
+    *s++ = digits[n];
   }
+  strcpy(s, w->Text);
 }
 
-void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+//
+//  Text aligned in the box (vertically in the middle)
+//
+static void ssd1306_WidgetText(SSD1306_t *dev, const SSD1306_Widget *w, int16_t x, int16_t y, char *s)
+{
+  int16_t pad = (w->Flags & WIDGET_BORDER) ? 2 : 0;
+
+  ssd1306h_DrawText(dev, x + pad, y, w->Width - 2 * pad, w->Height, s, *w->Font, TEXT_NOWRAP | TEXT_VALIGN_MIDDLE |
+                    ((w->Flags & WIDGET_ALIGN_RIGHT) ? TEXT_ALIGN_RIGHT : (w->Flags & WIDGET_ALIGN_CENTER) ? TEXT_ALIGN_CENTER : TEXT_ALIGN_LEFT));
+}
+
+//
+//  Draw the content of the widget (the box is already cleared)
+//
+static void ssd1306_WidgetContent(SSD1306_t *dev, const SSD1306_Widget *w, int16_t x, int16_t y, uint8_t invert)
 {
-  uint32_t phase;
-  uint8_t  raster;
-  if(hi2c->Instance == SSD1306_I2C_PORT.Instance)
+  char s[12 + SSD1306_WIDGET_TEXTSIZE];
+
+  if (w->Flags & WIDGET_BORDER)
+    ssd1306h_DrawRect(dev, x, y, w->Width, w->Height);
+  switch (w->Type)
   {
-    if(ssd1306_updatestatus)
-    {
-      if(ssd1306_updatestatus < ssd1306_updateend)
+    case WIDGET_LABEL:
+      if (w->Font != NULL)
+        ssd1306_WidgetText(dev, w, x, y, strcpy(s, w->Text));
+      break;
+    case WIDGET_VALUE:
+      if (w->Font != NULL)
       {
-        ssd1306_updatestatus++;
-        phase = ssd1306_updatestatus & 3;
-        if(phase == 3)
-        {
-          raster = (ssd1306_updatestatus >> 2) & (SSD1306_HEIGHT / 8 - 1);
-          if(ssd1306_RasterIntRegs & (1 << raster))
-            ssd1306_RasterIntCallback(raster);
-          HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x40, 1, &SSD1306_Buffer[SSD1306_WIDTH * ((ssd1306_updatestatus >> 2) & (SSD1306_HEIGHT / 8 - 1))], width());
-        }
-        else
+        ssd1306_WidgetFormat(w, s);
+        ssd1306_WidgetText(dev, w, x, y, s);
+      }
+      break;
+    case WIDGET_BAR:
+      ssd1306h_DrawRect(dev, x, y, w->Width, w->Height);
+      ssd1306h_FillRect(dev, x + 2, y + 2, (int16_t)(w->Width - 4) * w->Value / 100, w->Height - 4);
+      break;
+    case WIDGET_ICON:
+      if (w->Bitmap != NULL)
+        ssd1306h_Blit(dev, x, y, w->Width, w->Height, w->Bitmap, invert ? (BLIT_COPY | BLIT_INVERT) : BLIT_COPY);
+      break;
+    default:
+      break;
+  }
+}
+
+//
+//  Draw the changed widgets of a sibling list (x, y: position of the parent,
+//  clip: box of the parent, force: the parent was redrawn, every widget is drawn)
+//
+static uint16_t ssd1306_WidgetDraw(SSD1306_t *dev, SSD1306_Widget *w, int16_t x, int16_t y, const int16_t *clip, uint8_t invert, uint8_t force)
+{
+  int16_t box[4];
+  uint8_t redraw, winvert;
+  uint16_t n = 0;
+
+  for (; w != NULL; w = w->Next)
+  {
+    redraw = force || (w->Flags & WIDGET_DIRTY);
+    if (redraw || (w->Flags & WIDGET_CHILDDIRTY))
+    {
+      box[0] = (x + w->X > clip[0]) ? x + w->X : clip[0];
+      box[1] = (y + w->Y > clip[1]) ? y + w->Y : clip[1];
+      box[2] = (x + w->X + w->Width < clip[2]) ? x + w->X + w->Width : clip[2];
+      box[3] = (y + w->Y + w->Height < clip[3]) ? y + w->Y + w->Height : clip[3];
+      winvert = invert ^ ((w->Flags & WIDGET_INVERT) != 0);
+      if (redraw)
+      { /* clear the box with the background (hidden: of the parent) and draw */
+        ssd1306h_SetClipRect(dev, box[0], box[1], box[2] - box[0], box[3] - box[1]);
+        dev->Color = ((w->Flags & WIDGET_HIDDEN) ? invert : winvert) ? White : Black;
+        ssd1306h_FillRect(dev, x + w->X, y + w->Y, w->Width, w->Height);
+        dev->Color = winvert ? Black : White;
+        if (!(w->Flags & WIDGET_HIDDEN))
+          ssd1306_WidgetContent(dev, w, x + w->X, y + w->Y, winvert);
+        n++;
+      }
+      if (!(w->Flags & WIDGET_HIDDEN))
+      { /* the children are clipped to the box (inside the border) */
+        if (w->Flags & WIDGET_BORDER)
         {
-          if(phase == 0)
-            i2c_command = 0xB0 + ((ssd1306_updatestatus >> 2) & (SSD1306_HEIGHT / 8 - 1));
-          else if(phase == 1)
-            i2c_command = SETLOWCOLUMN;
-          else if(phase == 2)
-            i2c_command = SETHIGHCOLUMN;
-          HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &i2c_command, 1);
+          box[0] = (box[0] > x + w->X) ? box[0] : box[0] + 1;
+          box[1] = (box[1] > y + w->Y) ? box[1] : box[1] + 1;
+          box[2] = (box[2] < x + w->X + w->Width) ? box[2] : box[2] - 1;
+          box[3] = (box[3] < y + w->Y + w->Height) ? box[3] : box[3] - 1;
         }
+        n += ssd1306_WidgetDraw(dev, w->Child, x + w->X, y + w->Y, box, winvert, redraw);
       }
+    }
+    w->Flags &= ~(WIDGET_DIRTY | WIDGET_CHILDDIRTY);
+  }
+  return n;
+}
+
+//
+//  Draw the changed widgets of the tree into the screenbuffer (the update
+//  sends only their boxes), return the number of the redrawn widgets
+//  The root is the top widget (without parent and siblings), at the screen position X, Y.
+//  The color, the cursor and the clip rectangle of the display do not change.
+//
+uint16_t ssd1306h_WidgetRender(SSD1306_t *dev, SSD1306_Widget *root)
+{
+  int16_t screen[4] = {0, 0, SSD1306_WIDTH, dev->Height};
+  uint8_t clip[4];
+  SSD1306_COLOR color = dev->Color;
+  uint16_t cx = dev->CurrentX, cy = dev->CurrentY;
+  uint16_t n;
+
+  if (!(root->Flags & (WIDGET_DIRTY | WIDGET_CHILDDIRTY)))
+    return 0;
+  memcpy(clip, dev->Clip, sizeof(clip));
+  n = ssd1306_WidgetDraw(dev, root, 0, 0, screen, 0, 0);
+  memcpy(dev->Clip, clip, sizeof(clip));
+  dev->Color = color;
+  dev->CurrentX = cx;
+  dev->CurrentY = cy;
+  return n;
+}
+
+//
+//  Sprites
+//  A sprite is a page format image with a mask (or XOR mode) over the
+//  screenbuffer. Before drawing, the screen bytes under the box are saved
+//  (save-under), so it can be erased without redrawing the scene. The list of
+//  the sprites is in z-order (the first is at the bottom).
+//  ssd1306_SpriteUpdate redraws only the changed sprites and the ones above
+//  them that overlap their old or new box: these are erased from the top
+//  down, then drawn from the bottom up. So a moved sprite touches (and the
+//  update sends) only its old and new box.
+//
+
+//
+//  Initialize a sprite at x, y (image, mask: page format, mask NULL: the whole
+//  box, save: SSD1306_SPRITE_SAVESIZE(width, height) bytes, NULL with SPRITE_XOR)
+//
+void ssd1306_SpriteInit(SSD1306_Sprite *s, int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *image, const uint8_t *mask, uint8_t *save)
+{
+  memset(s, 0, sizeof(SSD1306_Sprite));
+  s->X = x;
+  s->Y = y;
+  s->Width = width;
+  s->Height = height;
+  s->Image = image;
+  s->Mask = mask;
+  s->Save = save;
+  s->Flags = SPRITE_DIRTY;
+}
+
+//
+//  Add the sprite to the list, over the sprites with z-order <= z
+//
+void ssd1306_SpriteAdd(SSD1306_Sprite **list, SSD1306_Sprite *s, uint8_t z)
+{
+  while (*list != NULL && (*list)->Z <= z)
+    list = &(*list)->Next;
+  s->Z = z;
+  s->Next = *list;
+  *list = s;
+  s->Flags |= SPRITE_DIRTY;
+}
+
+void ssd1306_SpriteMove(SSD1306_Sprite *s, int16_t x, int16_t y)
+{
+  if (s->X == x && s->Y == y)
+    return;
+  s->X = x;
+  s->Y = y;
+  s->Flags |= SPRITE_DIRTY;
+}
+
+//
+//  Change the image (animation frame) of the same size
+//
+void ssd1306_SpriteSetImage(SSD1306_Sprite *s, const uint8_t *image, const uint8_t *mask)
+{
+  if (s->Image == image && s->Mask == mask)
+    return;
+  s->Image = image;
+  s->Mask = mask;
+  s->Flags |= SPRITE_DIRTY;
+}
+
+//
+//  Set the flags (SPRITE_HIDDEN, SPRITE_XOR)
+//
+void ssd1306_SpriteSetFlags(SSD1306_Sprite *s, uint8_t flags)
+{
+  flags &= SPRITE_HIDDEN | SPRITE_XOR;
+  if ((s->Flags & (SPRITE_HIDDEN | SPRITE_XOR)) == flags)
+    return;
+  s->Flags = (s->Flags & ~(SPRITE_HIDDEN | SPRITE_XOR)) | flags | SPRITE_DIRTY;
+}
+
+//
+//  Are the boxes overlapping?
+//
+static uint8_t ssd1306_BoxOverlap(int16_t ax, int16_t ay, const SSD1306_Sprite *a, int16_t bx, int16_t by, const SSD1306_Sprite *b)
+{
+  return (ax < bx + b->Width) && (bx < ax + a->Width) && (ay < by + b->Height) && (by < ay + a->Height);
+}
+
+//
+//  Save the screen bytes under the box (the pages of the box on the screen)
+//
+static void ssd1306_SpriteSave(SSD1306_t *dev, SSD1306_Sprite *s)
+{
+  int16_t p0 = ssd1306_FloorDiv(s->Y, 8);
+  int16_t p, x0 = (s->X < 0) ? 0 : s->X;
+  int16_t x1 = (s->X + s->Width < SSD1306_WIDTH) ? s->X + s->Width : SSD1306_WIDTH;
+
+  for (p = (p0 < 0) ? 0 : p0; p <= ssd1306_FloorDiv(s->Y + s->Height - 1, 8) && p < dev->Pages; p++)
+  {
+    if (x0 < x1)
+      memcpy(&s->Save[(p - p0) * s->Width + x0 - s->X], &dev->Buffer[SSD1306_WIDTH * p + x0], x1 - x0);
+  }
+}
+
+//
+//  Erase the drawn sprite: XOR again, or the saved bytes back in the rows of the box
+//
+static void ssd1306_SpriteErase(SSD1306_t *dev, SSD1306_Sprite *s)
+{
+  int16_t x = s->DrawnX, y = s->DrawnY;
+  int16_t p0 = ssd1306_FloorDiv(y, 8);
+  int16_t p, c, x0 = (x < 0) ? 0 : x;
+  int16_t x1 = (x + s->Width < SSD1306_WIDTH) ? x + s->Width : SSD1306_WIDTH;
+  int16_t y0 = (y < 0) ? 0 : y;
+  int16_t y1 = (y + s->Height < dev->Height) ? y + s->Height : dev->Height;
+  uint8_t m, *d;
+  const uint8_t *v;
+
+  s->Flags &= ~SPRITE_DRAWN;
+  if (s->DrawnXor)
+  {
+    ssd1306h_Blit(dev, x, y, s->Width, s->Height, s->DrawnImage, BLIT_XOR);
+    return;
+  }
+  if (x0 >= x1 || y0 >= y1)
+    return;
+  for (p = y0 >> 3; p <= (y1 - 1) >> 3; p++)
+  {
+    m = 0xFF;
+    if (p == y0 >> 3)
+      m &= 0xFF << (y0 & 7);
+    if (p == (y1 - 1) >> 3)
+      m &= 0xFF >> (7 - ((y1 - 1) & 7));
+    d = &dev->Buffer[SSD1306_WIDTH * p + x0];
+    v = &s->Save[(p - p0) * s->Width + x0 - x];
+    for (c = x0; c < x1; c++, d++, v++)
+      *d = (*d & ~m) | (*v & m);
+  }
+  ssd1306_MarkDirty(dev, x0, y0, x1 - 1, y1 - 1);
+}
+
+//
+//  Erase the changed sprites from the top down (recursion to the end of the list)
+//
+static void ssd1306_SpriteEraseDirty(SSD1306_t *dev, SSD1306_Sprite *s)
+{
+  if (s == NULL)
+    return;
+  ssd1306_SpriteEraseDirty(dev, s->Next);
+  if ((s->Flags & (SPRITE_DIRTY | SPRITE_DRAWN)) == (SPRITE_DIRTY | SPRITE_DRAWN))
+    ssd1306_SpriteErase(dev, s);
+}
+
+//
+//  Draw the changed sprites (return the number of the redrawn sprites)
+//  The sprites above a changed one that overlap its old or new box are
+//  redrawn too, so they stay on the top.
+//
+uint16_t ssd1306h_SpriteUpdate(SSD1306_t *dev, SSD1306_Sprite *list)
+{
+  SSD1306_Sprite *s, *d;
+  uint8_t clip[4];
+  uint16_t n = 0;
+
+  for (s = list; s != NULL; s = s->Next)
+  {
+    for (d = list; d != s && !(s->Flags & SPRITE_DIRTY); d = d->Next)
+    {
+      if (!(d->Flags & SPRITE_DIRTY))
+        continue;
+      if (((s->Flags & SPRITE_DRAWN) &&
+           (((d->Flags & SPRITE_DRAWN) && ssd1306_BoxOverlap(s->DrawnX, s->DrawnY, s, d->DrawnX, d->DrawnY, d)) ||
+            (!(d->Flags & SPRITE_HIDDEN) && ssd1306_BoxOverlap(s->DrawnX, s->DrawnY, s, d->X, d->Y, d)))) ||
+          (!(s->Flags & SPRITE_HIDDEN) &&
+           (((d->Flags & SPRITE_DRAWN) && ssd1306_BoxOverlap(s->X, s->Y, s, d->DrawnX, d->DrawnY, d)) ||
+            (!(d->Flags & SPRITE_HIDDEN) && ssd1306_BoxOverlap(s->X, s->Y, s, d->X, d->Y, d)))))
+        s->Flags |= SPRITE_DIRTY;
+    }
+  }
+
+  memcpy(clip, dev->Clip, sizeof(clip));
+  ssd1306h_ResetClipRect(dev);
+  ssd1306_SpriteEraseDirty(dev, list);
+  for (s = list; s != NULL; s = s->Next)
+  {
+    if ((s->Flags & (SPRITE_DIRTY | SPRITE_HIDDEN)) == SPRITE_DIRTY)
+    {
+      if (s->Flags & SPRITE_XOR)
+        ssd1306h_Blit(dev, s->X, s->Y, s->Width, s->Height, s->Image, BLIT_XOR);
       else
-      { /* refresh end */
-        if(ssd1306_command)
-        { /* command ? */
-          i2c_command = ssd1306_command;
-          ssd1306_command = 0;
-        }
+      {
+        ssd1306_SpriteSave(dev, s);
+        if (s->Mask != NULL)
+          ssd1306h_DrawMaskedBitmap(dev, s->X, s->Y, s->Width, s->Height, s->Image, s->Mask);
         else
-        { /* refresh restart */
-          if(ssd1306_ContUpdate)
-          {
-            i2c_command = 0xB0;
-            ssd1306_updatestatus = SSD1306_HEIGHT;
-          }
-          else
-          {
-            ssd1306_updatestatus = 0;
-          }
-        }
-
-        if(ssd1306_updatestatus)
-          HAL_I2C_Mem_Write_DMA(&SSD1306_I2C_PORT, SSD1306_I2C_ADDR, 0x00, 1, &i2c_command, 1);
+          ssd1306h_Blit(dev, s->X, s->Y, s->Width, s->Height, s->Image, BLIT_COPY);
       }
+      s->DrawnX = s->X;
+      s->DrawnY = s->Y;
+      s->DrawnImage = s->Image;
+      s->DrawnXor = (s->Flags & SPRITE_XOR) != 0;
+      s->Flags |= SPRITE_DRAWN;
+      n++;
     }
+    s->Flags &= ~SPRITE_DIRTY;
   }
+  memcpy(dev->Clip, clip, sizeof(clip));
+  return n;
 }
 
-void ssd1306_SetRasterInt(uint8_t r)
+//
+//  Erase all sprites (e.g. before the background is changed under them),
+//  the next ssd1306_SpriteUpdate draws them again
+//
+void ssd1306h_SpriteEraseAll(SSD1306_t *dev, SSD1306_Sprite *list)
 {
-  ssd1306_RasterIntRegs = r;
+  SSD1306_Sprite *s;
+  uint8_t clip[4];
+
+  for (s = list; s != NULL; s = s->Next)
+    s->Flags |= SPRITE_DIRTY;
+  memcpy(clip, dev->Clip, sizeof(clip));
+  ssd1306h_ResetClipRect(dev);
+  ssd1306_SpriteEraseDirty(dev, list);
+  memcpy(dev->Clip, clip, sizeof(clip));
 }
 
-__weak void ssd1306_RasterIntCallback(uint8_t r)
+//
+//  n (<= 24) bits of a page format bitmap column from the row
+//
+static uint32_t ssd1306_SpriteBits(const uint8_t *bits, uint8_t width, uint8_t height, int16_t col, int16_t row, uint8_t n)
 {
+  uint8_t i, page = row >> 3;
+  uint32_t v = 0;
 
+  for (i = 0; i < 4 && page + i < (height + 7) >> 3; i++)
+    v |= (uint32_t)bits[(page + i) * width + col] << (8 * i);
+  return (v >> (row & 7)) & ((1UL << n) - 1);
 }
 
-#endif
+//
+//  Pixel exact collision of two sprites at their current position (the 1 bits
+//  of the masks, without mask the image): 1: overlapping, 0: not
+//  The boxes are tested first, then 24 rows of a column at once.
+//
+uint8_t ssd1306_SpriteCollide(const SSD1306_Sprite *a, const SSD1306_Sprite *b)
+{
+  const uint8_t *ma = (a->Mask != NULL) ? a->Mask : a->Image;
+  const uint8_t *mb = (b->Mask != NULL) ? b->Mask : b->Image;
+  int16_t x, y, x0, x1, y0, y1;
+  uint8_t n;
+
+  if ((a->Flags | b->Flags) & SPRITE_HIDDEN)
+    return 0;
+  if (!ssd1306_BoxOverlap(a->X, a->Y, a, b->X, b->Y, b))
+    return 0;
+  x0 = (a->X > b->X) ? a->X : b->X;
+  x1 = (a->X + a->Width < b->X + b->Width) ? a->X + a->Width : b->X + b->Width;
+  y0 = (a->Y > b->Y) ? a->Y : b->Y;
+  y1 = (a->Y + a->Height < b->Y + b->Height) ? a->Y + a->Height : b->Y + b->Height;
+  for (x = x0; x < x1; x++)
+  {
+    for (y = y0; y < y1; y += n)
+    {
+      n = (y1 - y < 24) ? y1 - y : 24;
+      if (ssd1306_SpriteBits(ma, a->Width, a->Height, x - a->X, y - a->Y, n) &
+          ssd1306_SpriteBits(mb, b->Width, b->Height, x - b->X, y - b->Y, n))
+        return 1;
+    }
+  }
+  return 0;
+}
 
+//
+//  Data of the address window in the screenbuffer (in the shadow, if it is used)
+//
+#if SSD1306_SHADOW == 0
+#define ssd1306_WindowData(dev)  &(dev)->Front[SSD1306_WIDTH * (dev)->Window[4] + (dev)->Window[1]]
+#else
+#define ssd1306_WindowData(dev)  &(dev)->Shadow[SSD1306_WIDTH * (dev)->Window[4] + (dev)->Window[1]]
 #endif
+#define ssd1306_WindowSize(dev)  (SSD1306_WIDTH * ((dev)->Window[5] - (dev)->Window[4]) + (dev)->Window[2] - (dev)->Window[1] + 1)
+
+// Changed column spans and start line of the buffer sent to the display
+#if SSD1306_DOUBLEBUF == 0
+#define ssd1306_FrontDirty(dev)  (dev)->Dirty
+#define ssd1306_FrontStartLine(dev) (dev)->StartLine
+#else
+#define ssd1306_FrontDirty(dev)  (dev)->FrontDirty
+#define ssd1306_FrontStartLine(dev) (dev)->FrontStartLine
+#endif
+
+//
+//  Size of the address window commands. If the start line of the buffer has
+//  changed, it is sent with the window, so the rotated screen (console) and
+//  the data of the new line arrive in the same update.
+//
+static uint8_t ssd1306_WindowCmds(SSD1306_t *dev)
+{
+  if (ssd1306_FrontStartLine(dev) == dev->ShownStartLine)
+    return 6;
+  dev->ShownStartLine = ssd1306_FrontStartLine(dev);
+  dev->Window[6] = SETSTARTLINE | dev->ShownStartLine;
+  return 7;
+}
+
+#if SSD1306_SHADOW == 1
+// Unchanged bytes inside a span that are worth an other address window
+// (window: 2 transactions, 10 bytes with the I2C addresses and control bytes)
+#define SSD1306_SHADOW_GAP       12
+
+//
+//  Narrow the changed span lo..hi of a page to the bytes that differ from the
+//  shadow and copy them into the shadow (the data transfer is sent from there,
+//  so the shadow is always what the display got, even if the drawing goes on).
+//  split: a long unchanged run ends the span, the rest stays marked as changed.
+//  (return 0: nothing differs, 1: span taken, 2: span taken, the page has more)
+//
+static uint8_t ssd1306_ShadowSpan(SSD1306_t *dev, uint8_t page, uint8_t *lo, uint8_t *hi, uint8_t split)
+{
+  const uint8_t *f = &dev->Front[SSD1306_WIDTH * page];
+  uint8_t *sh = &dev->Shadow[SSD1306_WIDTH * page];
+  uint8_t i, gap, ret = 1;
+
+  if (dev->ShadowValid & (1 << page))
+  {
+    while ((*lo <= *hi) && (f[*lo] == sh[*lo]))
+      (*lo)++;
+    if (*lo > *hi)
+      return 0;
+    while (f[*hi] == sh[*hi])
+      (*hi)--;
+    if (split)
+    {
+      for (i = *lo, gap = 0; i < *hi; i++)
+      {
+        if (f[i] != sh[i])
+          gap = 0;
+        else if (++gap > SSD1306_SHADOW_GAP)
+        {
+          ssd1306_FrontDirty(dev)[page] = (i + 1) | (*hi << 8);
+          *hi = i - gap;
+          ret = 2;
+          break;
+        }
+      }
+    }
+  }
+  else if ((*lo == 0) && (*hi == SSD1306_WIDTH - 1))
+    dev->ShadowValid |= 1 << page;
+
+  memcpy(&sh[*lo], &f[*lo], *hi - *lo + 1);
+  return ret;
+}
+#endif
+
+#if SSD1306_CONTUPDATE == 0
+//
+//  Take the changed column span of a page and set the address window to it.
+//  The following pages changed in full width are joined to the window, so
+//  a whole frame is sent in one transfer (horizontal addressing mode).
+//  With the shadow only the bytes differing from the display are sent.
+//  (return 0 if the page is unchanged, 2 if the page has an other span to send)
+//
+static uint8_t ssd1306_TakeDirtyPages(SSD1306_t *dev, uint8_t page)
+{
+  uint8_t last = page;
+  uint8_t lo, hi, ret = 1;
+  uint16_t span = ssd1306_FrontDirty(dev)[page];
+  lo = span & 0xFF;
+  hi = span >> 8;
+  if (lo > hi)
+    return 0;
+
+  ssd1306_FrontDirty(dev)[page] = 0x00FF;
+  #if SSD1306_SHADOW == 1
+  ret = ssd1306_ShadowSpan(dev, page, &lo, &hi, 1);
+  if (ret == 0)
+    return 0;
+  #endif
+  if ((lo == 0) && (hi == SSD1306_WIDTH - 1))
+  {
+    while ((last < dev->Pages - 1) && (ssd1306_FrontDirty(dev)[last + 1] == ((SSD1306_WIDTH - 1) << 8))
+    #if SSD1306_SHADOW == 1
+           && (!(dev->ShadowValid & (2 << last)) ||
+               ((dev->Front[SSD1306_WIDTH * (last + 1)] != dev->Shadow[SSD1306_WIDTH * (last + 1)]) &&
+                (dev->Front[SSD1306_WIDTH * (last + 2) - 1] != dev->Shadow[SSD1306_WIDTH * (last + 2) - 1])))
+    #endif
+          )
+    {
+      last++;
+      ssd1306_FrontDirty(dev)[last] = 0x00FF;
+      #if SSD1306_SHADOW == 1
+      ssd1306_ShadowSpan(dev, last, &lo, &hi, 0);
+      #endif
+    }
+  }
+
+  dev->Window[1] = lo;
+  dev->Window[2] = hi;
+  dev->Window[4] = page;
+  dev->Window[5] = last;
+  return ret;
+}
+#endif
+
+#if SSD1306_STATS == 1
+void ssd1306h_GetStats(SSD1306_t *dev, SSD1306_Stats *stats)
+{
+  uint32_t pm = __get_PRIMASK();
+  __disable_irq();
+  *stats = dev->Stats;
+  __set_PRIMASK(pm);
+}
+
+void ssd1306h_ResetStats(SSD1306_t *dev)
+{
+  uint32_t pm = __get_PRIMASK();
+  __disable_irq();
+  memset(&dev->Stats, 0, sizeof(dev->Stats));
+  dev->Stats.FrameTimeMin = 0xFFFFFFFF;
+  __set_PRIMASK(pm);
+}
+
+//
+//  Count an I2C transaction to the command (0x00) or data (0x40) register
+//
+static void ssd1306_StatTransfer(SSD1306_t *dev, uint8_t control, uint16_t size)
+{
+  dev->Stats.Transactions++;
+  dev->Stats.ControlBytes += 2;
+  if (control == 0x00)
+    dev->Stats.CommandBytes += size;
+  else
+    dev->Stats.DataBytes += size;
+}
+
+static void ssd1306_StatFrameStart(SSD1306_t *dev)
+{
+  dev->FrameStart = SSD1306_STATS_CLOCK();
+}
+
+static void ssd1306_StatFrameEnd(SSD1306_t *dev)
+{
+  uint32_t t = SSD1306_STATS_CLOCK() - dev->FrameStart;
+  dev->Stats.Frames++;
+  dev->Stats.FrameTime = t;
+  if (t < dev->Stats.FrameTimeMin)
+    dev->Stats.FrameTimeMin = t;
+  if (t > dev->Stats.FrameTimeMax)
+    dev->Stats.FrameTimeMax = t;
+}
+#endif
+
+//
+//  Send a byte to the command register
+//
+void ssd1306h_WriteCommand(SSD1306_t *dev, uint8_t command)
+{
+  ssd1306h_WriteCommands(dev, &command, 1);
+}
+
+#if SSD1306_USE_DMA == 0
+
+//
+//  Send data to the command (0x00) or data (0x40) register (one I2C transaction)
+//
+static void ssd1306_Transmit(SSD1306_t *dev, uint8_t control, uint8_t *data, uint16_t size)
+{
+  #if SSD1306_STATS == 1
+  ssd1306_StatTransfer(dev, control, size);
+  #endif
+  HAL_I2C_Mem_Write(dev->Port, dev->Address, control, 1, data, size, 10 + size);
+}
+
+//
+//  Send a command list to the command register (one I2C transaction)
+//
+void ssd1306h_WriteCommands(SSD1306_t *dev, const uint8_t *cmds, uint16_t n)
+{
+  ssd1306_Transmit(dev, 0x00, (uint8_t *)cmds, n);
+}
+
+//
+//  Write the changed parts of the screenbuffer to the screen
+//
+void ssd1306h_UpdateScreen(SSD1306_t *dev)
+{
+  uint8_t i = 0, r;
+  #if SSD1306_STATS == 1
+  uint32_t transactions;
+  #endif
+  if (dev->Scrolling)
+    return; /* the display RAM is not written while scrolling, ssd1306_StopScroll sends it */
+  #if SSD1306_STATS == 1
+  transactions = dev->Stats.Transactions;
+  ssd1306_StatFrameStart(dev);
+  #endif
+  while (i < dev->Pages)
+  {
+    r = ssd1306_TakeDirtyPages(dev, i);
+    if (r)
+    {
+      ssd1306_Transmit(dev, 0x00, dev->Window, ssd1306_WindowCmds(dev));
+      ssd1306_Transmit(dev, 0x40, ssd1306_WindowData(dev), ssd1306_WindowSize(dev));
+      i = dev->Window[5] + (r == 1); /* 2: the rest of the page */
+    }
+    else
+      i++;
+  }
+  #if SSD1306_STATS == 1
+  if (dev->Stats.Transactions != transactions)
+    ssd1306_StatFrameEnd(dev);
+  #endif
+}
+
+#elif SSD1306_USE_DMA == 1
+
+#if SSD1306_DOUBLEBUF == 1
+//
+//  Swap the drawing and the DMA buffer (only at frame boundary).
+//  The changes of the new frame are copied back to the drawing buffer,
+//  so the drawing can continue from the presented frame.
+//
+static void ssd1306_Swap(SSD1306_t *dev)
+{
+  uint8_t *b = dev->Front;
+  uint8_t page, lo, hi;
+  uint16_t span;
+
+  dev->Front = dev->Buffer;
+  dev->Buffer = b;
+  for (page = 0; page < dev->Pages; page++)
+  {
+    span = dev->Dirty[page];
+    lo = span & 0xFF;
+    hi = span >> 8;
+    if (lo <= hi)
+    {
+      memcpy(&dev->Buffer[SSD1306_WIDTH * page + lo], &dev->Front[SSD1306_WIDTH * page + lo], hi - lo + 1);
+      span = dev->FrontDirty[page];
+      if ((span & 0xFF) < lo) lo = span & 0xFF;
+      if ((span >> 8) > hi) hi = span >> 8;
+      dev->FrontDirty[page] = lo | (hi << 8);
+      dev->Dirty[page] = 0x00FF;
+    }
+  }
+  dev->FrontStartLine = dev->StartLine;
+  dev->SwapRequest = 0;
+}
+#endif
+
+//
+//  Start a DMA transfer to the command (0x00) or data (0x40) register
+//
+static void ssd1306_Transmit(SSD1306_t *dev, uint8_t control, uint8_t *data, uint16_t size)
+{
+  #if SSD1306_STATS == 1
+  ssd1306_StatTransfer(dev, control, size);
+  #endif
+  HAL_I2C_Mem_Write_DMA(dev->Port, dev->Address, control, 1, data, size);
+}
+
+static uint8_t ssd1306_Start(SSD1306_t *dev);
+static void ssd1306_TxCplt(SSD1306_t *dev);
+static void ssd1306_Completed(SSD1306_t *dev);
+
+//
+//  The display transferring on the I2C bus (NULL if there is none)
+//
+static SSD1306_t *ssd1306_BusOwner(I2C_HandleTypeDef *hi2c)
+{
+  SSD1306_t *dev;
+  for (dev = ssd1306_Devices; dev != NULL; dev = dev->Next)
+  {
+    if ((dev->Port->Instance == hi2c->Instance) && dev->UpdateStatus)
+      break;
+  }
+  return dev;
+}
+
+//
+//  Is there an other display waiting for the I2C bus of this display?
+//
+static uint8_t ssd1306_BusWaiting(SSD1306_t *dev)
+{
+  SSD1306_t *d;
+  for (d = ssd1306_Devices; d != NULL; d = d->Next)
+  {
+    if ((d != dev) && (d->Port->Instance == dev->Port->Instance) && d->BusRequest)
+      return 1;
+  }
+  return 0;
+}
+
+//
+//  Start the transfers of the display. If an other display is transferring on the
+//  same I2C bus, the display is only marked as waiting and the DMA interrupt of
+//  the other display starts it (the displays of a bus follow each other without polling).
+//
+static void ssd1306_Request(SSD1306_t *dev)
+{
+  uint32_t pm = __get_PRIMASK();
+  uint8_t done = 0;
+  while(!done)
+  {
+    __disable_irq();
+    if(dev->UpdateStatus || dev->BusRequest)
+    { /* running or waiting: the interrupt continues it */
+      done = 1;
+    }
+    else if(ssd1306_BusOwner(dev->Port) != NULL)
+    {
+      dev->BusRequest = 1;
+      done = 1;
+    }
+    else if(HAL_I2C_GetState(dev->Port) == HAL_I2C_STATE_READY)
+    { /* nothing to send (no change): the update is completed at once */
+      if(!ssd1306_Start(dev))
+        ssd1306_Completed(dev);
+      done = 1;
+    }
+    __set_PRIMASK(pm);
+  }
+}
+
+//
+//  The I2C bus is free: start the next waiting display after the last one (round robin)
+//
+static void ssd1306_StartNext(I2C_HandleTypeDef *hi2c, SSD1306_t *last)
+{
+  SSD1306_t *dev = last;
+  if(ssd1306_Devices == NULL)
+    return;
+  do
+  {
+    dev = ((dev != NULL) && (dev->Next != NULL)) ? dev->Next : ssd1306_Devices;
+    if((dev->Port->Instance == hi2c->Instance) && dev->BusRequest)
+    {
+      dev->BusRequest = 0;
+      if(ssd1306_Start(dev))
+        return;
+      ssd1306_Completed(dev);
+    }
+  } while((dev != last) && !((last == NULL) && (dev->Next == NULL)));
+}
+
+//
+//  End of a DMA transfer: the display of the bus continues, or the next waiting display starts
+//
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  SSD1306_t *dev = ssd1306_BusOwner(hi2c);
+  if(dev != NULL)
+  {
+    ssd1306_TxCplt(dev);
+    if(dev->UpdateStatus)
+      return;
+  }
+  ssd1306_StartNext(hi2c, dev);
+}
+
+#if SSD1306_CONTUPDATE == 0
+
+//
+//  Send a command list to the command register (one I2C transaction / SSD1306_COMMANDS_SIZE bytes)
+//
+void ssd1306h_WriteCommands(SSD1306_t *dev, const uint8_t *cmds, uint16_t n)
+{
+  uint16_t size;
+  while(n)
+  {
+    size = (n < SSD1306_COMMANDS_SIZE) ? n : SSD1306_COMMANDS_SIZE;
+    while(dev->UpdateStatus || dev->BusRequest)
+    {
+      #if SSD1306_STATS == 1
+      dev->Stats.WaitSpins++;
+      #endif
+    }
+    memcpy(dev->Commands, cmds, size);
+    dev->CmdSize = size;
+    ssd1306_Request(dev);
+    cmds += size;
+    n -= size;
+  }
+}
+
+//
+//  Start the address window of the next changed page(s)
+//  (return 0 if there are no more changed pages)
+//
+static uint8_t ssd1306_UpdateNextPage(SSD1306_t *dev)
+{
+  uint8_t r;
+  while(dev->UpdatePage < dev->Pages)
+  {
+    r = ssd1306_TakeDirtyPages(dev, dev->UpdatePage);
+    if(r)
+    {
+      dev->UpdatePage = dev->Window[5] + (r == 1); /* 2: the rest of the page */
+      dev->UpdateStatus = 1;
+      ssd1306_Transmit(dev, 0x00, dev->Window, ssd1306_WindowCmds(dev));
+      return 1;
+    }
+    dev->UpdatePage++;
+  }
+  return 0;
+}
+
+//
+//  Start the next work of the idle display: commands, swap at frame boundary, update restart
+//  (return 0 if there is nothing to send)
+//
+static uint8_t ssd1306_Start(SSD1306_t *dev)
+{
+  if(dev->CmdSize)
+  {
+    dev->UpdateStatus = 3;
+    ssd1306_Transmit(dev, 0x00, dev->Commands, dev->CmdSize);
+    return 1;
+  }
+  #if SSD1306_STATS == 1
+  ssd1306_StatFrameStart(dev);
+  #endif
+  #if SSD1306_DOUBLEBUF == 1
+  if(dev->SwapRequest)
+  { /* frame boundary -> swap buffers */
+    ssd1306_Swap(dev);
+    dev->UpdatePage = 0;
+    if(!dev->Scrolling && ssd1306_UpdateNextPage(dev))
+      return 1;
+  }
+  #endif
+  if(dev->UpdateRestart && !dev->Scrolling)
+  { /* the pages already sent are changed again (while scrolling it waits for ssd1306_StopScroll) */
+    dev->UpdateRestart = 0;
+    dev->UpdatePage = 0;
+    return ssd1306_UpdateNextPage(dev);
+  }
+  return 0;
+}
+
+#if SSD1306_DOUBLEBUF == 0
+//
+//  Write the changed parts of the screenbuffer to the screen
+//
+void ssd1306h_UpdateScreen(SSD1306_t *dev)
+{
+  /* if the update is running, the interrupt restarts it at the end (the pages already sent are changed again) */
+  #if SSD1306_STATS == 1
+  if(dev->UpdateRestart)
+    dev->Stats.Coalesced++;
+  #endif
+  dev->UpdateRestart = 1;
+  ssd1306_Request(dev);
+}
+#else
+//
+//  Request the swap of the drawing buffer with the DMA buffer at the end of the running update
+//  without waiting (1: the swap is done, 0: pending, do not draw until ssd1306h_PresentPending is 0)
+//
+uint8_t ssd1306h_TryPresent(SSD1306_t *dev)
+{
+  dev->SwapRequest = 1;
+  ssd1306_Request(dev);
+  return !dev->SwapRequest;
+}
+
+//
+//  Present the drawing buffer: it is swapped with the DMA buffer at the end of the running update
+//  (wait until the swap is done, after that the drawing can continue in the other buffer)
+//  Do not call it from interrupt context (callbacks, band renderer): the swap happens in the DMA
+//  interrupt, so the wait would never end. Use ssd1306h_TryPresent there.
+//
+void ssd1306h_Present(SSD1306_t *dev)
+{
+  ssd1306h_TryPresent(dev);
+  while(dev->SwapRequest);
+}
+#endif
+
+char ssd1306h_UpdateScreenCompleted(SSD1306_t *dev)
+{
+  if(dev->UpdateStatus || dev->BusRequest)
+    return 0;
+  else
+    return 1;
+}
+
+__weak void ssd1306_UpdateCompletedCallback(void) { };
+
+static void ssd1306_Completed(SSD1306_t *dev)
+{
+  if(dev->UpdateCompletedCallback != NULL)
+    dev->UpdateCompletedCallback(dev);
+}
+
+//
+//  Status: 1: address window, 2: data, 3: commands
+//
+static void ssd1306_TxCplt(SSD1306_t *dev)
+{
+  #if SSD1306_STATS == 1
+  dev->Stats.Interrupts++;
+  #endif
+  if(dev->UpdateStatus == 1)
+  { /* address window sent -> data */
+    dev->UpdateStatus = 2;
+    ssd1306_Transmit(dev, 0x40, ssd1306_WindowData(dev), ssd1306_WindowSize(dev));
+    return;
+  }
+  if(dev->UpdateStatus == 2)
+  { /* data sent -> next changed page(s) */
+    if(ssd1306_UpdateNextPage(dev))
+      return;
+    #if SSD1306_STATS == 1
+    ssd1306_StatFrameEnd(dev);
+    #endif
+  }
+  else
+    dev->CmdSize = 0;
+
+  dev->UpdateStatus = 0;
+  if(ssd1306_BusWaiting(dev))
+    dev->BusRequest = 1; /* an other display goes first, this display continues after it */
+  else if(!ssd1306_Start(dev))
+    ssd1306_Completed(dev);
+}
+
+#elif SSD1306_CONTUPDATE == 1
+
+//
+//  Start the DMA of the queued commands, up to the end of the queue memory
+//  (return 0 if the queue is empty)
+//
+static uint8_t ssd1306_SendQueuedCommands(SSD1306_t *dev)
+{
+  uint8_t tail = dev->CmdTail & (SSD1306_CMDQUEUE_SIZE - 1);
+  uint8_t size = (uint8_t)(dev->CmdHead - dev->CmdTail);
+  if(size == 0)
+    return 0;
+
+  if(size > SSD1306_CMDQUEUE_SIZE - tail)
+    size = SSD1306_CMDQUEUE_SIZE - tail;
+  dev->CmdSize = size;
+  dev->UpdateStatus = 3;
+  ssd1306_Transmit(dev, 0x00, &dev->CmdQueue[tail], size);
+  return 1;
+}
+
+//
+//  Start the next work of the idle display: queued commands or the next frame
+//  (return 0 if there is nothing to send)
+//
+static uint8_t ssd1306_Start(SSD1306_t *dev)
+{
+  if(ssd1306_SendQueuedCommands(dev))
+    return 1;
+  if(dev->ContUpdate && !dev->Scrolling)
+  { /* the refresh is paused while scrolling */
+    #if SSD1306_STATS == 1
+    ssd1306_StatFrameStart(dev);
+    #endif
+    dev->UpdateStatus = 1;
+    ssd1306_Transmit(dev, 0x00, dev->Window, ssd1306_WindowCmds(dev));
+    return 1;
+  }
+  return 0;
+}
+
+static void ssd1306_Completed(SSD1306_t *dev) { (void)dev; }
+
+//
+//  Put a command list into the command queue without waiting
+//  The list is sent in the same gap between two frames (in whole).
+//  (return 1: queued, 0: not enough space in the queue, nothing queued)
+//
+uint8_t ssd1306h_TryWriteCommands(SSD1306_t *dev, const uint8_t *cmds, uint16_t n)
+{
+  uint8_t head = dev->CmdHead;
+  if(n > (uint8_t)(SSD1306_CMDQUEUE_SIZE - (uint8_t)(head - dev->CmdTail)))
+    return 0;
+
+  while(n--)
+    dev->CmdQueue[head++ & (SSD1306_CMDQUEUE_SIZE - 1)] = *cmds++;
+  dev->CmdHead = head;
+
+  /* if the update is stopped, the DMA interrupt is started here */
+  if((dev->UpdateStatus == 0) && (dev->BusRequest == 0))
+    ssd1306_Request(dev);
+  return 1;
+}
+
+//
+//  Send a command list to the command register
+//  The commands are queued and sent by the DMA interrupt between the frames.
+//  It waits only if the queue is full (longer lists than the queue are sent in more parts).
+//
+void ssd1306h_WriteCommands(SSD1306_t *dev, const uint8_t *cmds, uint16_t n)
+{
+  uint16_t size;
+  while(n)
+  {
+    size = (n < SSD1306_CMDQUEUE_SIZE) ? n : SSD1306_CMDQUEUE_SIZE;
+    while(!ssd1306h_TryWriteCommands(dev, cmds, size))
+    {
+      #if SSD1306_STATS == 1
+      dev->Stats.WaitSpins++;
+      #endif
+    }
+    cmds += size;
+    n -= size;
+  }
+}
+
+void ssd1306h_ContUpdateEnable(SSD1306_t *dev)
+{
+  if(!dev->ContUpdate)
+  {
+    /* if the command queue is being sent, the DMA interrupt starts the update */
+    dev->ContUpdate = 1;
+    ssd1306_Request(dev);
+  }
+}
+
+void ssd1306h_ContUpdateDisable(SSD1306_t *dev)
+{
+  if(dev->ContUpdate)
+  {
+    dev->ContUpdate = 0;
+    while(dev->UpdateStatus || dev->BusRequest) { };
+  }
+}
+
+#if SSD1306_DOUBLEBUF == 1
+//
+//  Request the swap of the drawing buffer with the DMA buffer at the end of the running frame
+//  without waiting (1: the swap is done, 0: pending, do not draw until ssd1306h_PresentPending is 0)
+//
+uint8_t ssd1306h_TryPresent(SSD1306_t *dev)
+{
+  uint32_t pm = __get_PRIMASK();
+  dev->SwapRequest = 1;
+  __disable_irq();
+  if(dev->UpdateStatus == 0)
+    ssd1306_Swap(dev);
+  __set_PRIMASK(pm);
+  return !dev->SwapRequest;
+}
+
+//
+//  Present the drawing buffer: it is swapped with the DMA buffer at the end of the running frame
+//  (wait until the swap is done, after that the drawing can continue in the other buffer)
+//  Do not call it from interrupt context (callbacks, band renderer): the swap happens in the DMA
+//  interrupt, so the wait would never end. Use ssd1306h_TryPresent there.
+//
+void ssd1306h_Present(SSD1306_t *dev)
+{
+  ssd1306h_TryPresent(dev);
+  while(dev->SwapRequest);
+}
+#endif
+
+//
+//  Band renderer: draw the band of pages page .. end - 1 for the next frame.
+//  The band was just sent and the transfer of the next page is already running,
+//  the renderer is clipped to the band, so it cannot draw into the pages not sent yet.
+//
+static void ssd1306_RenderBand(SSD1306_t *dev, uint8_t end)
+{
+  uint8_t clip[4];
+  uint8_t page = (end - 1) / dev->BandPages * dev->BandPages;
+
+  memcpy(clip, dev->Clip, sizeof(clip));
+  ssd1306h_SetClipRect(dev, 0, 8 * page, SSD1306_WIDTH, 8 * (end - page));
+  dev->BandRenderer(dev, page, end - page);
+  memcpy(dev->Clip, clip, sizeof(clip));
+}
+
+//
+//  Continuous update: the address window is set to the whole screen at every
+//  frame, then the frame goes in one transfer (or page by page, if there are
+//  raster interrupts or a band renderer). Between two frames the queued commands
+//  are sent and the other displays of the I2C bus can be updated.
+//  Status: 1: window, 2: frame data, 3: commands
+//
+static void ssd1306_TxCplt(SSD1306_t *dev)
+{
+  uint8_t frame;
+
+  #if SSD1306_STATS == 1
+  dev->Stats.Interrupts++;
+  #endif
+  if(dev->UpdateStatus == 1)
+  { /* address window sent -> frame data */
+    dev->UpdateStatus = 2;
+    dev->UpdatePage = 0;
+    if(dev->RasterIntRegs == 0 && dev->BandRenderer == NULL)
+    {
+      dev->UpdatePage = dev->Pages - 1;
+      ssd1306_Transmit(dev, 0x40, dev->Front, SSD1306_WIDTH * dev->Pages);
+      return;
+    }
+  }
+  else if(dev->UpdateStatus == 2 && dev->UpdatePage < dev->Pages - 1)
+  { /* page data sent -> next page */
+    dev->UpdatePage++;
+  }
+  else
+  { /* refresh end */
+    frame = (dev->UpdateStatus == 2);
+    #if SSD1306_DOUBLEBUF == 1
+    if(dev->SwapRequest)
+      ssd1306_Swap(dev);
+    #endif
+    if(dev->UpdateStatus == 3)
+      dev->CmdTail += dev->CmdSize;
+    #if SSD1306_STATS == 1
+    else
+      ssd1306_StatFrameEnd(dev);
+    #endif
+    dev->UpdateStatus = 0;
+    if(ssd1306_BusWaiting(dev))
+      dev->BusRequest = 1; /* an other display goes first, this display continues after it */
+    else
+      ssd1306_Start(dev); /* queued commands or refresh restart */
+    if(frame && dev->BandRenderer != NULL)
+      ssd1306_RenderBand(dev, dev->Pages);
+    return;
+  }
+
+  if((dev->RasterIntRegs & (1 << dev->UpdatePage)) && (dev->RasterIntCallback != NULL))
+    dev->RasterIntCallback(dev, dev->UpdatePage);
+  ssd1306_Transmit(dev, 0x40, &dev->Front[SSD1306_WIDTH * dev->UpdatePage], SSD1306_WIDTH);
+  if(dev->UpdatePage % dev->BandPages == 0 && dev->UpdatePage != 0 && dev->BandRenderer != NULL)
+    ssd1306_RenderBand(dev, dev->UpdatePage);
+}
+
+void ssd1306h_SetRasterInt(SSD1306_t *dev, uint8_t r)
+{
+  dev->RasterIntRegs = r;
+}
+
+//
+//  Set the band renderer (beam racing): the screen is split into bands of
+//  bandPages pages, and just after the last page of a band was sent, the renderer
+//  draws the band of the next frame, while the DMA sends the other pages.
+//  The display never shows a partly drawn band without a second screen buffer.
+//
+void ssd1306h_SetBandRenderer(SSD1306_t *dev, uint8_t bandPages, void (*renderer)(SSD1306_t *dev, uint8_t page, uint8_t pages))
+{
+  uint32_t pm = __get_PRIMASK();
+  __disable_irq();
+  dev->BandPages = (bandPages == 0) ? 1 : bandPages;
+  dev->BandRenderer = renderer;
+  __set_PRIMASK(pm);
+}
+
+__weak void ssd1306_RasterIntCallback(uint8_t r)
+{
+  (void)r;
+}
+
+#endif
+
+#endif
+
+//
+//  Start a continuous scroll (the scroll is set up after a stop, as the data sheet requires).
+//  From here the display RAM is not written (it is changed by the scroll), the updates
+//  wait for ssd1306_StopScroll: the scroll costs no I2C traffic while running.
+//
+static void ssd1306_StartScroll(SSD1306_t *dev, uint8_t cmd, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed, uint8_t vOffset)
+{
+  uint8_t cmds[9] = {DEACTIVATESCROLL, cmd, 0x00, startPage & 7, speed & 7, endPage & 7};
+  uint8_t n = 6;
+
+  if ((cmd == RIGHTHORIZONTALSCROLL) || (cmd == LEFTHORIZONTALSCROLL))
+  {
+    cmds[n++] = 0x00;
+    cmds[n++] = 0xFF;
+    dev->Scrolling = 1;
+  }
+  else
+  {
+    cmds[n++] = vOffset & 0x3F;
+    dev->Scrolling = 2;
+  }
+  cmds[n++] = ACTIVATESCROLL;
+  ssd1306h_WriteCommands(dev, cmds, n);
+}
+
+void ssd1306h_ScrollRight(SSD1306_t *dev, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed)
+{
+  ssd1306_StartScroll(dev, RIGHTHORIZONTALSCROLL, startPage, endPage, speed, 0);
+}
+
+void ssd1306h_ScrollLeft(SSD1306_t *dev, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed)
+{
+  ssd1306_StartScroll(dev, LEFTHORIZONTALSCROLL, startPage, endPage, speed, 0);
+}
+
+void ssd1306h_ScrollDiagRight(SSD1306_t *dev, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed, uint8_t vOffset)
+{
+  ssd1306_StartScroll(dev, VERTRIGHTHORIZSCROLL, startPage, endPage, speed, vOffset);
+}
+
+void ssd1306h_ScrollDiagLeft(SSD1306_t *dev, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed, uint8_t vOffset)
+{
+  ssd1306_StartScroll(dev, VERTLEFTHORIZSCROLL, startPage, endPage, speed, vOffset);
+}
+
+//
+//  Set the rows of the vertical scroll: fixedRows on the top are not scrolled,
+//  the next scrollRows rows are scrolled (fixedRows + scrollRows <= height)
+//
+void ssd1306h_SetVerticalScrollArea(SSD1306_t *dev, uint8_t fixedRows, uint8_t scrollRows)
+{
+  if (fixedRows + scrollRows > dev->Height)
+    return;
+  dev->ScrollArea[0] = fixedRows;
+  dev->ScrollArea[1] = scrollRows;
+  ssd1306h_WriteCommands(dev, (const uint8_t[]){SETVERTICALSCROLLAREA, fixedRows, scrollRows}, 3);
+}
+
+//
+//  Stop the scroll. The scroll has moved the display RAM, so the screenbuffer
+//  is sent again: after that the display shows the screenbuffer (and the
+//  drawing continues from it). The vertical scroll position is set back by
+//  sending the vertical scroll area again.
+//
+void ssd1306h_StopScroll(SSD1306_t *dev)
+{
+  uint8_t page;
+
+  if (dev->Scrolling == 2)
+    ssd1306h_WriteCommands(dev, (const uint8_t[]){DEACTIVATESCROLL, SETVERTICALSCROLLAREA, dev->ScrollArea[0], dev->ScrollArea[1]}, 4);
+  else
+    ssd1306h_WriteCommand(dev, DEACTIVATESCROLL);
+  dev->Scrolling = 0;
+
+  for (page = 0; page < dev->Pages; page++)
+  {
+    ssd1306_FrontDirty(dev)[page] = (SSD1306_WIDTH - 1) << 8;
+  }
+  #if SSD1306_SHADOW == 1
+  dev->ShadowValid = 0;
+  #endif
+
+  #if SSD1306_USE_DMA == 0
+  ssd1306h_UpdateScreen(dev);
+  #elif SSD1306_CONTUPDATE == 0
+  dev->UpdateRestart = 1;
+  ssd1306_Request(dev);
+  #else
+  ssd1306_Request(dev);
+  #endif
+}
@@ -28,7 +28,7 @@
 #include <string.h>
 
 // I2c address
-#define SSD1306_I2C_ADDR       SSD1306_ADDRESS << 1 // 0x3C << 1 = 0x78
+#define SSD1306_I2C_ADDR       (SSD1306_ADDRESS << 1) // 0x3C << 1 = 0x78
 
 #ifdef  SSD1306_128X64
 #define SSD1306_GEOMETRY       GEOMETRY_128_64
@@ -47,7 +47,14 @@
 // SSD1306 LCD Buffer Size
 #define SSD1306_BUFFER_SIZE   (SSD1306_WIDTH * SSD1306_HEIGHT / 8)
 
+// Size of the command buffer in DMA mode (the longer command lists are sent in more parts)
+#define SSD1306_COMMANDS_SIZE  32
+
+// Size of the command queue in continuous update mode (power of 2, max 128)
+#define SSD1306_CMDQUEUE_SIZE  64
+
 // Display commands
+#define ACTIVATESCROLL        0x2F
 #define CHARGEPUMP            0x8D
 #define COLUMNADDR            0x21
 #define COMSCANDEC            0xC8
@@ -56,11 +63,14 @@
 #define DISPLAYALLON_RESUME   0xA4
 #define DISPLAYOFF            0xAE
 #define DISPLAYON             0xAF
+#define DEACTIVATESCROLL      0x2E
 #define EXTERNALVCC           0x01
 #define INVERTDISPLAY         0xA7
+#define LEFTHORIZONTALSCROLL  0x27
 #define MEMORYMODE            0x20
 #define NORMALDISPLAY         0xA6
 #define PAGEADDR              0x22
+#define RIGHTHORIZONTALSCROLL 0x26
 #define SEGREMAP              0xA0
 #define SETCOMPINS            0xDA
 #define SETCONTRAST           0x81
@@ -73,7 +83,10 @@
 #define SETSEGMENTREMAP       0xA1
 #define SETSTARTLINE          0x40
 #define SETVCOMDETECT         0xDB
+#define SETVERTICALSCROLLAREA 0xA3
 #define SWITCHCAPVCC          0x02
+#define VERTRIGHTHORIZSCROLL  0x29
+#define VERTLEFTHORIZSCROLL   0x2A
 
 #define SWAP_INT16_T(a, b) { int16_t t = a; a = b; b = t; }
 //
@@ -89,15 +102,155 @@ typedef enum {
   GEOMETRY_128_64 = 0,
   GEOMETRY_128_32 = 1
 } SSD1306_Geometry;
+
+//
+//  Time between the scroll steps (frames), the codes of the scroll commands
+//
+typedef enum {
+  SCROLL_FRAMES_2   = 0x07,
+  SCROLL_FRAMES_3   = 0x04,
+  SCROLL_FRAMES_4   = 0x05,
+  SCROLL_FRAMES_5   = 0x00,
+  SCROLL_FRAMES_25  = 0x06,
+  SCROLL_FRAMES_64  = 0x01,
+  SCROLL_FRAMES_128 = 0x02,
+  SCROLL_FRAMES_256 = 0x03
+} SSD1306_ScrollSpeed;
+
+//
+//  Raster operations of the blit (ssd1306_Blit), on the bits of the source
+//
+typedef enum {
+  BLIT_COPY        = 0x00,  // the source is copied (1: set, 0: cleared)
+  BLIT_OR          = 0x01,  // set where the source is 1
+  BLIT_AND         = 0x02,  // cleared where the source is 0
+  BLIT_XOR         = 0x03,  // inverted where the source is 1
+  BLIT_TRANSPARENT = 0x04,  // the 1 bits are drawn with the color (White, Black, Inverse), the 0 bits are not drawn
+  BLIT_INVERT      = 0x08   // flag: the source is inverted first (e.g. BLIT_COPY | BLIT_INVERT)
+} SSD1306_BlitOp;
+
+//
+//  Inside of a self-intersecting polygon (ssd1306_FillPolygon)
+//
+typedef enum {
+  FILL_EVENODD  = 0,        // odd number of edges to the outside
+  FILL_NONZERO  = 1         // nonzero winding number
+} SSD1306_FillRule;
+
+//
+//  Text layout in a box (ssd1306_DrawText)
+//
+#define TEXT_ALIGN_LEFT     0x00  // horizontal alignment of the lines
+#define TEXT_ALIGN_CENTER   0x01
+#define TEXT_ALIGN_RIGHT    0x02
+#define TEXT_JUSTIFY        0x03  // the spaces are widened to the box width (not in the last line of a paragraph)
+#define TEXT_VALIGN_MIDDLE  0x04  // vertical alignment of the lines, default: top
+#define TEXT_VALIGN_BOTTOM  0x08
+#define TEXT_NOWRAP         0x10  // new lines only at '\n', a long line is cut at the box edge
+
 //
-//  Struct to store transformations
+//  A line of a text (ssd1306_TextBreak)
 //
 typedef struct {
+  const char    *Start;           // first byte of the line
+  uint16_t      Length;           // bytes of the line (without the spaces at the break)
+  uint16_t      Width;            // pixels
+  uint8_t       Spaces;           // spaces in the line (widened in a justified line)
+  uint8_t       Last;             // last line of a paragraph (before '\n' or the end of the text)
+  const char    *Next;            // first byte of the next line
+} SSD1306_TextLine;
+//
+//  Transfer statistics (SSD1306_STATS == 1)
+//
+typedef struct {
+  uint32_t      Frames;           // completed updates (frames in continuous update mode)
+  uint32_t      DataBytes;        // display data bytes (payload)
+  uint32_t      CommandBytes;     // command bytes (address window and commands)
+  uint32_t      ControlBytes;     // I2C address and control bytes (overhead, 2 per transaction)
+  uint32_t      Transactions;     // I2C transactions
+  uint32_t      Interrupts;       // DMA interrupts
+  uint32_t      Coalesced;        // UpdateScreen requests merged into the running update
+  uint32_t      WaitSpins;        // busy-wait loops of the command writing
+  uint32_t      FrameTime;        // time of the last frame (SSD1306_STATS_CLOCK ticks)
+  uint32_t      FrameTimeMin;
+  uint32_t      FrameTimeMax;
+} SSD1306_Stats;
+
+//
+//  Display handle: transformations, screenbuffer and transfer state of one display
+//  (more displays can be used, also on the same I2C bus)
+//
+typedef struct SSD1306_t {
   uint16_t      CurrentX;
   uint16_t      CurrentY;
   uint8_t       Inverted;
   SSD1306_COLOR Color;
   uint8_t       Initialized;
+
+  I2C_HandleTypeDef *Port;        // I2C port
+  uint16_t      Address;          // I2C address (shifted, 0x3C << 1 = 0x78)
+  SSD1306_Geometry Geometry;
+  uint8_t       Height;           // height in pixels (max SSD1306_HEIGHT)
+  uint8_t       Pages;            // number of memory pages (Height / 8)
+
+  uint8_t      *Buffer;           // screenbuffer (drawing buffer)
+  uint8_t      *Front;            // buffer sent to the display (the same as Buffer without double buffering)
+  volatile uint16_t Dirty[SSD1306_HEIGHT / 8]; // changed column span of every page (low byte: first column, high byte: last column)
+  uint8_t       Window[7];        // column and page address window of the next data transfer (+ start line, if it has changed)
+  uint8_t       StartLine;        // display start line of the screenbuffer (the console rotates it)
+  volatile uint8_t  ShownStartLine; // start line sent to the display
+  volatile uint8_t  Scrolling;    // 0: no, 1: horizontal, 2: vertical and horizontal scroll (the display RAM is not written)
+  uint8_t       ScrollArea[2];    // vertical scroll area: fixed rows on the top, scrolled rows
+  uint8_t       Clip[4];          // clip rectangle of the drawing: left, top, right + 1, bottom + 1
+
+  const uint16_t *ConsoleFont;    // text console (ssd1306_ConsoleInit)
+  const uint8_t *ConsoleFontPages;
+  const FontPacked *ConsoleFontPacked;
+  uint8_t       ConsoleFontWidth;
+  uint8_t       ConsoleFontHeight;
+  uint8_t       ConsoleLineHeight; // rows of a line (8, 16 or 32, so a line is whole pages)
+  uint8_t       ConsoleLines;     // lines on the screen
+  uint8_t       ConsoleLine;      // line of the cursor (0: top of the screen)
+  uint8_t       ConsoleX;         // column of the cursor
+  uint8_t       ConsoleNewLine;   // the new line is started with the next char
+  char          ConsoleUtf8[4];   // received bytes of an UTF-8 char
+  uint8_t       ConsoleUtf8Len;
+#if SSD1306_DOUBLEBUF == 1
+  volatile uint16_t FrontDirty[SSD1306_HEIGHT / 8]; // changed column spans of the front buffer
+  volatile uint8_t  SwapRequest;
+  volatile uint8_t  FrontStartLine;
+#endif
+#if SSD1306_USE_DMA == 1
+  volatile uint8_t  UpdateStatus; // 0: idle, 1: address window, 2: data, 3: commands
+  volatile uint8_t  UpdatePage;
+  volatile uint8_t  BusRequest;   // waiting for the I2C bus (an other display on the same bus is transferring)
+#if SSD1306_CONTUPDATE == 0
+  volatile uint8_t  UpdateRestart;
+  volatile uint8_t  CmdSize;
+  uint8_t           Commands[SSD1306_COMMANDS_SIZE];
+  void (*UpdateCompletedCallback)(struct SSD1306_t *dev);      // end of the update (interrupt function)
+#else
+  volatile uint8_t  ContUpdate;
+  volatile uint8_t  RasterIntRegs;
+  volatile uint8_t  CmdHead;
+  volatile uint8_t  CmdTail;
+  volatile uint8_t  CmdSize;
+  uint8_t           CmdQueue[SSD1306_CMDQUEUE_SIZE];
+  void (*RasterIntCallback)(struct SSD1306_t *dev, uint8_t r); // beginning of PAGEr (interrupt function)
+  volatile uint8_t  BandPages;    // pages of a band of the band renderer
+  void (*volatile BandRenderer)(struct SSD1306_t *dev, uint8_t page, uint8_t pages); // draws a band after it was sent (interrupt function)
+#endif
+  struct SSD1306_t *Next;         // next display in the list of the DMA interrupt
+#endif
+#if SSD1306_SHADOW == 1
+  volatile uint8_t ShadowValid;   // pages of the shadow equal to the display RAM (bit n: PAGEn)
+  uint8_t       Shadow[SSD1306_BUFFER_SIZE]; // the frame sent to the display (the data transfers are sent from here)
+#endif
+#if SSD1306_STATS == 1
+  SSD1306_Stats Stats;
+  uint32_t      FrameStart;
+#endif
+  uint8_t       Buffers[SSD1306_DOUBLEBUF + 1][SSD1306_BUFFER_SIZE];
 } SSD1306_t;
 
 typedef struct {
@@ -105,68 +258,305 @@ typedef struct {
     uint8_t y;
 } SSD1306_VERTEX;
 
+//
+//  Retained widgets (ssd1306_WidgetRender redraws only the changed ones)
+//
+typedef enum {
+  WIDGET_CONTAINER = 0,     // group of widgets (the children are positioned and clipped in its box)
+  WIDGET_LABEL     = 1,     // text
+  WIDGET_VALUE     = 2,     // number with decimal point and unit
+  WIDGET_BAR       = 3,     // horizontal bar of 0..100 percent
+  WIDGET_ICON      = 4      // bitmap of the page format
+} SSD1306_WidgetType;
+
+#define WIDGET_HIDDEN       0x01  // the widget and its children are not drawn (the box is cleared)
+#define WIDGET_INVERT       0x02  // black on white (also the children)
+#define WIDGET_BORDER       0x04  // rectangle around the box
+#define WIDGET_ALIGN_CENTER 0x08  // text alignment (label, value), default: left
+#define WIDGET_ALIGN_RIGHT  0x10
+#define WIDGET_DIRTY        0x40  // (internal) the widget has to be redrawn
+#define WIDGET_CHILDDIRTY   0x80  // (internal) a widget below has to be redrawn
+
+typedef struct SSD1306_Widget {
+  uint8_t       Type;             // SSD1306_WidgetType
+  uint8_t       Flags;
+  int16_t       X, Y;             // position in the parent
+  uint8_t       Width, Height;    // box
+  struct SSD1306_Widget *Parent, *Child, *Next;
+  const FontDef *Font;            // label, value
+  int32_t       Value;            // value, bar (percent)
+  uint8_t       Decimals;         // value: digits after the decimal point
+  const uint8_t *Bitmap;          // icon
+  char          Text[SSD1306_WIDGET_TEXTSIZE]; // label: text, value: unit
+} SSD1306_Widget;
+
+//
+//  Sprites (ssd1306_SpriteUpdate), the list is in z-order (the first is at the bottom)
+//
+#define SPRITE_HIDDEN       0x01  // not drawn (erased)
+#define SPRITE_XOR          0x02  // the image is XORed on the screen (no mask, no save-under)
+#define SPRITE_DIRTY        0x40  // (internal) has to be redrawn
+#define SPRITE_DRAWN        0x80  // (internal) is on the screen
+
+// Bytes of the save-under buffer of a sprite (the pages of the box at any y)
+#define SSD1306_SPRITE_SAVESIZE(w, h)  ((w) * (((h) + 7) / 8 + 1))
+
+typedef struct SSD1306_Sprite {
+  int16_t       X, Y;             // position on the screen
+  uint8_t       Width, Height;
+  uint8_t       Flags;
+  uint8_t       Z;                // z-order
+  const uint8_t *Image;           // page format
+  const uint8_t *Mask;            // page format, NULL: the whole box
+  uint8_t       *Save;            // save-under buffer (SSD1306_SPRITE_SAVESIZE bytes)
+  int16_t       DrawnX, DrawnY;   // where it is drawn
+  const uint8_t *DrawnImage;
+  uint8_t       DrawnXor;
+  struct SSD1306_Sprite *Next;
+} SSD1306_Sprite;
+
 //  Definition of the i2c port in main
 extern I2C_HandleTypeDef SSD1306_I2C_PORT;
 
-/* Private function prototypes -----------------------------------------------*/
-uint16_t ssd1306_GetWidth(void);
-uint16_t ssd1306_GetHeight(void);
-SSD1306_COLOR ssd1306_GetColor(void);
-void ssd1306_SetColor(SSD1306_COLOR color);
-uint8_t ssd1306_Init(void);
-void ssd1306_Fill(void);
-void ssd1306_DrawPixel(uint8_t x, uint8_t y);
-void ssd1306_DrawBitmap(uint8_t X, uint8_t Y, uint8_t W, uint8_t H, const uint8_t* pBMP);
-void ssd1306_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
-void ssd1306_DrawVerticalLine(int16_t x, int16_t y, int16_t length);
-void ssd1306_DrawHorizontalLine(int16_t x, int16_t y, int16_t length);
-void ssd1306_DrawRect(int16_t x, int16_t y, int16_t width, int16_t height);
-void ssd1306_DrawTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3);
-void ssd1306_FillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height);
-void ssd1306_DrawArc(uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep);
-void ssd1306_DrawCircle(int16_t x0, int16_t y0, int16_t radius);
-void ssd1306_FillCircle(int16_t x0, int16_t y0, int16_t radius);
-void ssd1306_Polyline(const SSD1306_VERTEX *par_vertex, uint16_t par_size);
-void ssd1306_DrawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads);
-void ssd1306_DrawProgressBar(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress);
-char ssd1306_WriteChar(char ch, FontDef Font);
-char ssd1306_WriteString(char* str, FontDef Font);
-void ssd1306_SetCursor(uint8_t x, uint8_t y);
-void ssd1306_Clear(void);
-
-void ssd1306_WriteCommand(uint8_t command);
-
-#define ssd1306_DisplayOn()             ssd1306_WriteCommand(DISPLAYON)
-#define ssd1306_DisplayOff()            ssd1306_WriteCommand(DISPLAYOFF)
-#define ssd1306_InvertDisplay()         ssd1306_WriteCommand(INVERTDISPLAY)
-#define ssd1306_NormalDisplay()         ssd1306_WriteCommand(NORMALDISPLAY)
-#define ssd1306_ResetOrientation()      { ssd1306_WriteCommand(SEGREMAP); ssd1306_WriteCommand(COMSCANINC); }
-#define ssd1306_FlipScreenVertically()  { ssd1306_WriteCommand(SEGREMAP | 0x01); ssd1306_WriteCommand(COMSCANDEC); }
-#define ssd1306_MirrorScreen()          { ssd1306_WriteCommand(SEGREMAP | 0x01); ssd1306_WriteCommand(COMSCANINC); }
-#define ssd1306_MirrorFlipScreen()      { ssd1306_WriteCommand(SEGREMAP); ssd1306_WriteCommand(COMSCANDEC); }
+//  Default display (SSD1306_I2C_PORT, SSD1306_ADDRESS, SSD1306_GEOMETRY), used by the ssd1306_... functions
+extern SSD1306_t hssd1306;
+
+/* Display handle functions --------------------------------------------------*/
+uint8_t ssd1306h_Init(SSD1306_t *dev, I2C_HandleTypeDef *port, uint8_t address, SSD1306_Geometry geometry);
+uint16_t ssd1306h_GetWidth(SSD1306_t *dev);
+uint16_t ssd1306h_GetHeight(SSD1306_t *dev);
+SSD1306_COLOR ssd1306h_GetColor(SSD1306_t *dev);
+void ssd1306h_SetColor(SSD1306_t *dev, SSD1306_COLOR color);
+void ssd1306h_Fill(SSD1306_t *dev);      /* fill the screen with the color (Inverse: invert it) */
+void ssd1306h_InvertBuffer(SSD1306_t *dev);
+void ssd1306h_CopyBuffer(SSD1306_t *dev, const uint8_t *src); /* copy a whole screen (the screenbuffer format) */
+void ssd1306h_DrawPixel(SSD1306_t *dev, uint8_t x, uint8_t y);
+void ssd1306h_DrawBitmap(SSD1306_t *dev, uint8_t X, uint8_t Y, uint8_t W, uint8_t H, const uint8_t* pBMP);
+void ssd1306h_DrawMaskedBitmap(SSD1306_t *dev, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *image, const uint8_t *mask); /* the image where the mask is 1, the rest is not drawn */
+void ssd1306h_Blit(SSD1306_t *dev, int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t *src, uint8_t op); /* draw a page format bitmap with a raster operation (SSD1306_BlitOp) */
+void ssd1306h_DrawCompressedBitmap(SSD1306_t *dev, int16_t x, int16_t y, const uint8_t *data, uint8_t op); /* draw a bitmap of Tools/image/imgpack.c with a raster operation */
+void ssd1306h_SetClipRect(SSD1306_t *dev, int16_t x, int16_t y, int16_t w, int16_t h); /* the drawing functions draw only in the rectangle (not Fill, Clear) */
+void ssd1306h_ResetClipRect(SSD1306_t *dev); /* clip rectangle = whole screen */
+void ssd1306h_DrawLine(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void ssd1306h_DrawVerticalLine(SSD1306_t *dev, int16_t x, int16_t y, int16_t length);
+void ssd1306h_DrawHorizontalLine(SSD1306_t *dev, int16_t x, int16_t y, int16_t length);
+void ssd1306h_DrawRect(SSD1306_t *dev, int16_t x, int16_t y, int16_t width, int16_t height);
+void ssd1306h_DrawTriangle(SSD1306_t *dev, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3);
+void ssd1306h_DrawFillTriangle(SSD1306_t *dev, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3);
+void ssd1306h_FillRect(SSD1306_t *dev, int16_t xMove, int16_t yMove, int16_t width, int16_t height);
+void ssd1306h_DrawRoundRect(SSD1306_t *dev, int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius);
+void ssd1306h_FillRoundRect(SSD1306_t *dev, int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius);
+void ssd1306h_DrawArc(SSD1306_t *dev, uint8_t x, uint8_t y, uint8_t radius, uint16_t start_angle, uint16_t sweep); /* angles in degree: 0 bottom, 90 right, 180 top, 270 left */
+void ssd1306h_DrawEllipseArc(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t rx, int16_t ry, int16_t start_angle, uint16_t sweep);
+void ssd1306h_DrawEllipse(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t rx, int16_t ry);
+void ssd1306h_FillEllipse(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t rx, int16_t ry);
+void ssd1306h_FillPie(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t rx, int16_t ry, int16_t start_angle, uint16_t sweep); /* filled sector start_angle .. start_angle + sweep */
+int16_t ssd1306_Sin(int16_t deg);        /* sin(deg) * 16384 without floating point (e.g. the needle of a gauge) */
+int16_t ssd1306_Cos(int16_t deg);
+void ssd1306h_DrawCircle(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t radius);
+void ssd1306h_FillCircle(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t radius);
+void ssd1306h_Polyline(SSD1306_t *dev, const SSD1306_VERTEX *par_vertex, uint16_t par_size);
+void ssd1306h_FillPolygon(SSD1306_t *dev, const SSD1306_VERTEX *vertex, uint16_t size, SSD1306_FillRule rule); /* closed polygon, max SSD1306_POLYGON_MAXVERTICES vertices */
+void ssd1306h_DrawCircleQuads(SSD1306_t *dev, int16_t x0, int16_t y0, int16_t radius, uint8_t quads);
+void ssd1306h_DrawProgressBar(SSD1306_t *dev, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t progress);
+char ssd1306h_WriteChar(SSD1306_t *dev, char ch, FontDef Font); /* Latin-1 char (packed fonts: U+0000 .. U+00FF, the others: ' ' .. '~') */
+char ssd1306h_WriteString(SSD1306_t *dev, char* str, FontDef Font); /* UTF-8, returns 0 or the first byte of the char not written */
+uint32_t ssd1306h_WriteCodePoint(SSD1306_t *dev, uint32_t cp, FontDef Font); /* Unicode char, returns cp or 0: not written */
+uint16_t ssd1306_TextWidth(const char *str, FontDef Font); /* pixels of the UTF-8 text (the widest line) */
+uint8_t ssd1306_TextBreak(const char *str, uint16_t width, FontDef Font, SSD1306_TextLine *line); /* the next line for the width, 0: end of the text */
+uint16_t ssd1306_TextLines(const char *str, uint16_t width, FontDef Font); /* lines of the text broken for the width */
+uint16_t ssd1306h_DrawText(SSD1306_t *dev, int16_t x, int16_t y, int16_t w, int16_t h, const char *str, FontDef Font, uint8_t flags); /* TEXT_..., returns the bytes of the text shown completely */
+void ssd1306h_SetCursor(SSD1306_t *dev, uint8_t x, uint8_t y);
+void ssd1306h_Clear(SSD1306_t *dev);
+void ssd1306h_Invalidate(SSD1306_t *dev); /* mark the whole screenbuffer as changed (the next update sends everything, also with SSD1306_SHADOW) */
+
+void ssd1306h_WriteCommand(SSD1306_t *dev, uint8_t command);
+void ssd1306h_WriteCommands(SSD1306_t *dev, const uint8_t *cmds, uint16_t n); /* send a command list behind one control byte (one I2C transaction) */
+
+void ssd1306h_ScrollRight(SSD1306_t *dev, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed); /* continuous horizontal scroll of PAGEstart..PAGEend */
+void ssd1306h_ScrollLeft(SSD1306_t *dev, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed);
+void ssd1306h_ScrollDiagRight(SSD1306_t *dev, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed, uint8_t vOffset); /* horizontal scroll and vertical scroll of the scroll area (vOffset rows / step) */
+void ssd1306h_ScrollDiagLeft(SSD1306_t *dev, uint8_t startPage, uint8_t endPage, SSD1306_ScrollSpeed speed, uint8_t vOffset);
+void ssd1306h_SetVerticalScrollArea(SSD1306_t *dev, uint8_t fixedRows, uint8_t scrollRows); /* rows of the vertical scroll (default: 0, height) */
+void ssd1306h_StopScroll(SSD1306_t *dev);  /* stop the scroll and send the screenbuffer again (the display shows it again) */
+#define ssd1306h_IsScrolling(dev)           ((dev)->Scrolling != 0)
+
+#if SSD1306_STATS == 1
+void ssd1306h_GetStats(SSD1306_t *dev, SSD1306_Stats *stats); /* copy the transfer statistics */
+void ssd1306h_ResetStats(SSD1306_t *dev);
+#endif
+
+#define ssd1306h_DisplayOn(dev)             ssd1306h_WriteCommand(dev, DISPLAYON)
+#define ssd1306h_DisplayOff(dev)            ssd1306h_WriteCommand(dev, DISPLAYOFF)
+#define ssd1306h_InvertDisplay(dev)         ssd1306h_WriteCommand(dev, INVERTDISPLAY)
+#define ssd1306h_NormalDisplay(dev)         ssd1306h_WriteCommand(dev, NORMALDISPLAY)
+#define ssd1306h_SetContrast(dev, c)        ssd1306h_WriteCommands(dev, (const uint8_t[]){SETCONTRAST, (c)}, 2)
+#define ssd1306h_ResetOrientation(dev)      ssd1306h_WriteCommands(dev, (const uint8_t[]){SEGREMAP, COMSCANINC}, 2)
+#define ssd1306h_FlipScreenVertically(dev)  ssd1306h_WriteCommands(dev, (const uint8_t[]){SEGREMAP | 0x01, COMSCANDEC}, 2)
+#define ssd1306h_MirrorScreen(dev)          ssd1306h_WriteCommands(dev, (const uint8_t[]){SEGREMAP | 0x01, COMSCANINC}, 2)
+#define ssd1306h_MirrorFlipScreen(dev)      ssd1306h_WriteCommands(dev, (const uint8_t[]){SEGREMAP, COMSCANDEC}, 2)
 
 #if  SSD1306_USE_DMA == 0
-void ssd1306_UpdateScreen(void);      /* copy the contents of the Screenbuffer (SSD1306_Buffer) to the display */
-#define ssd1306_UpdateScreenCompleted() 1
-#define ssd1306_ContUpdateEnable()
-#define ssd1306_ContUpdateDisable()
-#define ssd1306_SetRasterInt(r)
+void ssd1306h_UpdateScreen(SSD1306_t *dev); /* copy the contents of the Screenbuffer to the display */
+#define ssd1306h_UpdateScreenCompleted(dev) 1
+#define ssd1306h_ContUpdateEnable(dev)
+#define ssd1306h_ContUpdateDisable(dev)
+#define ssd1306h_SetRasterInt(dev, r)
+#define ssd1306h_SetBandRenderer(dev, bandPages, renderer)
 #elif SSD1306_USE_DMA == 1
+#if   SSD1306_DOUBLEBUF == 1
+void ssd1306h_Present(SSD1306_t *dev);    /* swap the drawing buffer to the display at the end of the running frame (wait for the swap, not from interrupt) */
+uint8_t ssd1306h_TryPresent(SSD1306_t *dev); /* request the swap without waiting (1:swapped, 0:pending) */
+#define ssd1306h_PresentPending(dev)      ((dev)->SwapRequest) /* 1: the requested swap is not done yet (do not draw) */
+#endif
 #if   SSD1306_CONTUPDATE == 0
-void ssd1306_UpdateScreen(void);      /* copy the contents of the Screenbuffer (SSD1306_Buffer) to the display */
-char ssd1306_UpdateScreenCompleted(void); /* asks if the update is already complete (0:not completed, 1:completed) */
-__weak void ssd1306_UpdateCompletedCallback(void); /* you can create a function for the end of the update (attention!: interrupt function) */
-#define ssd1306_ContUpdateEnable()
-#define ssd1306_ContUpdateDisable()
-#define ssd1306_SetRasterInt(r)
+#if   SSD1306_DOUBLEBUF == 0
+void ssd1306h_UpdateScreen(SSD1306_t *dev); /* copy the contents of the Screenbuffer to the display */
+#else
+#define ssd1306h_UpdateScreen(dev)        ssd1306h_Present(dev)
+#endif
+char ssd1306h_UpdateScreenCompleted(SSD1306_t *dev); /* asks if the update is already complete (0:not completed, 1:completed) */
+#define ssd1306h_ContUpdateEnable(dev)
+#define ssd1306h_ContUpdateDisable(dev)
+#define ssd1306h_SetRasterInt(dev, r)
+#define ssd1306h_SetBandRenderer(dev, bandPages, renderer)
 #elif SSD1306_CONTUPDATE == 1
-#define ssd1306_UpdateScreen()
-#define ssd1306_UpdateScreenCompleted() 1
-void ssd1306_ContUpdateEnable(void);  /* enable the continuous dsplay update in background (use DMA and interrupt) */
-void ssd1306_ContUpdateDisable(void); /* disable the continuous dsplay update in background */
-void ssd1306_SetRasterInt(uint8_t r); /* enable raster interrupt(s) of PAGEx (0:NONE, 1:PAGE0, 2:PAGE1, 4:PAGE2 ... 128:PAGE7, 255:All_PAGES) */
-__weak void ssd1306_RasterIntCallback(uint8_t r); /* 0:At the beginning of PAGE0, 1:PAGE1, 2:PAGE2 ... 7:PAGE7 (attention!: interrupt function) */
+#if   SSD1306_DOUBLEBUF == 0
+#define ssd1306h_UpdateScreen(dev)
+#else
+#define ssd1306h_UpdateScreen(dev)        ssd1306h_Present(dev)
 #endif
+#define ssd1306h_UpdateScreenCompleted(dev) 1
+void ssd1306h_ContUpdateEnable(SSD1306_t *dev);  /* enable the continuous dsplay update in background (use DMA and interrupt) */
+uint8_t ssd1306h_TryWriteCommands(SSD1306_t *dev, const uint8_t *cmds, uint16_t n); /* queue a command list without waiting (1:queued, 0:queue is full) */
+#define ssd1306h_TryWriteCommand(dev, c)  ssd1306h_TryWriteCommands(dev, (const uint8_t[]){(c)}, 1)
+void ssd1306h_ContUpdateDisable(SSD1306_t *dev); /* disable the continuous dsplay update in background */
+void ssd1306h_SetRasterInt(SSD1306_t *dev, uint8_t r); /* enable raster interrupt(s) of PAGEx (0:NONE, 1:PAGE0, 2:PAGE1, 4:PAGE2 ... 128:PAGE7, 255:All_PAGES) */
+void ssd1306h_SetBandRenderer(SSD1306_t *dev, uint8_t bandPages, void (*renderer)(SSD1306_t *dev, uint8_t page, uint8_t pages)); /* draw the bands of bandPages pages just after they were sent (NULL: off, attention!: interrupt function) */
+#endif
+#endif
+
+void ssd1306h_ConsoleInit(SSD1306_t *dev, FontDef Font); /* clear the screen and start the text console with the font */
+void ssd1306h_ConsoleClear(SSD1306_t *dev);
+void ssd1306h_ConsolePutChar(SSD1306_t *dev, char ch); /* UTF-8 bytes, '\n': new line, '\r': line start, wraps at the end of the line */
+void ssd1306h_ConsoleWrite(SSD1306_t *dev, const char *str);
+
+void ssd1306_WidgetInit(SSD1306_Widget *w, SSD1306_WidgetType type, int16_t x, int16_t y, uint8_t width, uint8_t height);
+void ssd1306_WidgetAdd(SSD1306_Widget *parent, SSD1306_Widget *w); /* add a child (drawn over the parent and the children before it) */
+void ssd1306_WidgetSetFlags(SSD1306_Widget *w, uint8_t flags); /* WIDGET_HIDDEN, WIDGET_INVERT, WIDGET_BORDER, WIDGET_ALIGN_... */
+void ssd1306_WidgetSetText(SSD1306_Widget *w, const char *text); /* the setters mark the widget changed only if the content is different */
+void ssd1306_WidgetSetFont(SSD1306_Widget *w, const FontDef *font);
+void ssd1306_WidgetSetValue(SSD1306_Widget *w, int32_t value);
+void ssd1306_WidgetSetDecimals(SSD1306_Widget *w, uint8_t decimals);
+void ssd1306_WidgetSetBitmap(SSD1306_Widget *w, const uint8_t *bitmap);
+void ssd1306_WidgetInvalidate(SSD1306_Widget *w); /* redraw the widget and its children at the next render */
+uint16_t ssd1306h_WidgetRender(SSD1306_t *dev, SSD1306_Widget *root); /* draw the changed widgets (return: number of redrawn widgets) */
+
+void ssd1306_SpriteInit(SSD1306_Sprite *s, int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *image, const uint8_t *mask, uint8_t *save);
+void ssd1306_SpriteAdd(SSD1306_Sprite **list, SSD1306_Sprite *s, uint8_t z); /* put the sprite into the list over the sprites of z-order <= z */
+void ssd1306_SpriteMove(SSD1306_Sprite *s, int16_t x, int16_t y);
+void ssd1306_SpriteSetImage(SSD1306_Sprite *s, const uint8_t *image, const uint8_t *mask); /* animation frame of the same size */
+void ssd1306_SpriteSetFlags(SSD1306_Sprite *s, uint8_t flags); /* SPRITE_HIDDEN, SPRITE_XOR */
+uint8_t ssd1306_SpriteCollide(const SSD1306_Sprite *a, const SSD1306_Sprite *b); /* pixel exact overlap of the masks (1: collision) */
+uint16_t ssd1306h_SpriteUpdate(SSD1306_t *dev, SSD1306_Sprite *list); /* erase and redraw the changed sprites (return: number of redrawn sprites) */
+void ssd1306h_SpriteEraseAll(SSD1306_t *dev, SSD1306_Sprite *list); /* restore the background under all sprites (the next update draws them again) */
+
+/* Default display functions -------------------------------------------------*/
+uint8_t ssd1306_Init(void);
+#define ssd1306_GetWidth()                  ssd1306h_GetWidth(&hssd1306)
+#define ssd1306_GetHeight()                 ssd1306h_GetHeight(&hssd1306)
+#define ssd1306_GetColor()                  ssd1306h_GetColor(&hssd1306)
+#define ssd1306_SetColor(...)               ssd1306h_SetColor(&hssd1306, __VA_ARGS__)
+#define ssd1306_Fill()                      ssd1306h_Fill(&hssd1306)
+#define ssd1306_InvertBuffer()              ssd1306h_InvertBuffer(&hssd1306)
+#define ssd1306_CopyBuffer(...)             ssd1306h_CopyBuffer(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawPixel(...)              ssd1306h_DrawPixel(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawBitmap(...)             ssd1306h_DrawBitmap(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawMaskedBitmap(...)       ssd1306h_DrawMaskedBitmap(&hssd1306, __VA_ARGS__)
+#define ssd1306_Blit(...)                   ssd1306h_Blit(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawCompressedBitmap(...)   ssd1306h_DrawCompressedBitmap(&hssd1306, __VA_ARGS__)
+#define ssd1306_SetClipRect(...)            ssd1306h_SetClipRect(&hssd1306, __VA_ARGS__)
+#define ssd1306_ResetClipRect()             ssd1306h_ResetClipRect(&hssd1306)
+#define ssd1306_DrawLine(...)               ssd1306h_DrawLine(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawVerticalLine(...)       ssd1306h_DrawVerticalLine(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawHorizontalLine(...)     ssd1306h_DrawHorizontalLine(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawRect(...)               ssd1306h_DrawRect(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawTriangle(...)           ssd1306h_DrawTriangle(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawFillTriangle(...)       ssd1306h_DrawFillTriangle(&hssd1306, __VA_ARGS__)
+#define ssd1306_FillRect(...)               ssd1306h_FillRect(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawRoundRect(...)          ssd1306h_DrawRoundRect(&hssd1306, __VA_ARGS__)
+#define ssd1306_FillRoundRect(...)          ssd1306h_FillRoundRect(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawArc(...)                ssd1306h_DrawArc(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawEllipseArc(...)         ssd1306h_DrawEllipseArc(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawEllipse(...)            ssd1306h_DrawEllipse(&hssd1306, __VA_ARGS__)
+#define ssd1306_FillEllipse(...)            ssd1306h_FillEllipse(&hssd1306, __VA_ARGS__)
+#define ssd1306_FillPie(...)                ssd1306h_FillPie(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawCircle(...)             ssd1306h_DrawCircle(&hssd1306, __VA_ARGS__)
+#define ssd1306_FillCircle(...)             ssd1306h_FillCircle(&hssd1306, __VA_ARGS__)
+#define ssd1306_Polyline(...)               ssd1306h_Polyline(&hssd1306, __VA_ARGS__)
+#define ssd1306_FillPolygon(...)            ssd1306h_FillPolygon(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawCircleQuads(...)        ssd1306h_DrawCircleQuads(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawProgressBar(...)        ssd1306h_DrawProgressBar(&hssd1306, __VA_ARGS__)
+#define ssd1306_WriteChar(...)              ssd1306h_WriteChar(&hssd1306, __VA_ARGS__)
+#define ssd1306_WriteString(...)            ssd1306h_WriteString(&hssd1306, __VA_ARGS__)
+#define ssd1306_WriteCodePoint(...)         ssd1306h_WriteCodePoint(&hssd1306, __VA_ARGS__)
+#define ssd1306_DrawText(...)               ssd1306h_DrawText(&hssd1306, __VA_ARGS__)
+#define ssd1306_SetCursor(...)              ssd1306h_SetCursor(&hssd1306, __VA_ARGS__)
+#define ssd1306_Clear()                     ssd1306h_Clear(&hssd1306)
+#define ssd1306_Invalidate()                ssd1306h_Invalidate(&hssd1306)
+
+#define ssd1306_WriteCommand(...)           ssd1306h_WriteCommand(&hssd1306, __VA_ARGS__)
+#define ssd1306_WriteCommands(...)          ssd1306h_WriteCommands(&hssd1306, __VA_ARGS__)
+
+#define ssd1306_ScrollRight(...)            ssd1306h_ScrollRight(&hssd1306, __VA_ARGS__)
+#define ssd1306_ScrollLeft(...)             ssd1306h_ScrollLeft(&hssd1306, __VA_ARGS__)
+#define ssd1306_ScrollDiagRight(...)        ssd1306h_ScrollDiagRight(&hssd1306, __VA_ARGS__)
+#define ssd1306_ScrollDiagLeft(...)         ssd1306h_ScrollDiagLeft(&hssd1306, __VA_ARGS__)
+#define ssd1306_SetVerticalScrollArea(...)  ssd1306h_SetVerticalScrollArea(&hssd1306, __VA_ARGS__)
+#define ssd1306_StopScroll()                ssd1306h_StopScroll(&hssd1306)
+#define ssd1306_IsScrolling()               ssd1306h_IsScrolling(&hssd1306)
+
+#define ssd1306_ConsoleInit(...)            ssd1306h_ConsoleInit(&hssd1306, __VA_ARGS__)
+#define ssd1306_ConsoleClear()              ssd1306h_ConsoleClear(&hssd1306)
+#define ssd1306_ConsolePutChar(...)         ssd1306h_ConsolePutChar(&hssd1306, __VA_ARGS__)
+#define ssd1306_ConsoleWrite(...)           ssd1306h_ConsoleWrite(&hssd1306, __VA_ARGS__)
+
+#define ssd1306_WidgetRender(...)           ssd1306h_WidgetRender(&hssd1306, __VA_ARGS__)
+#define ssd1306_SpriteUpdate(...)           ssd1306h_SpriteUpdate(&hssd1306, __VA_ARGS__)
+#define ssd1306_SpriteEraseAll(...)         ssd1306h_SpriteEraseAll(&hssd1306, __VA_ARGS__)
+
+#if SSD1306_STATS == 1
+#define ssd1306_GetStats(...)               ssd1306h_GetStats(&hssd1306, __VA_ARGS__)
+#define ssd1306_ResetStats()                ssd1306h_ResetStats(&hssd1306)
+#endif
+
+#define ssd1306_DisplayOn()                 ssd1306h_DisplayOn(&hssd1306)
+#define ssd1306_DisplayOff()                ssd1306h_DisplayOff(&hssd1306)
+#define ssd1306_InvertDisplay()             ssd1306h_InvertDisplay(&hssd1306)
+#define ssd1306_NormalDisplay()             ssd1306h_NormalDisplay(&hssd1306)
+#define ssd1306_SetContrast(...)            ssd1306h_SetContrast(&hssd1306, __VA_ARGS__)
+#define ssd1306_ResetOrientation()          ssd1306h_ResetOrientation(&hssd1306)
+#define ssd1306_FlipScreenVertically()      ssd1306h_FlipScreenVertically(&hssd1306)
+#define ssd1306_MirrorScreen()              ssd1306h_MirrorScreen(&hssd1306)
+#define ssd1306_MirrorFlipScreen()          ssd1306h_MirrorFlipScreen(&hssd1306)
+
+#define ssd1306_UpdateScreen()              ssd1306h_UpdateScreen(&hssd1306)
+#define ssd1306_UpdateScreenCompleted()     ssd1306h_UpdateScreenCompleted(&hssd1306)
+#define ssd1306_ContUpdateEnable()          ssd1306h_ContUpdateEnable(&hssd1306)
+#define ssd1306_ContUpdateDisable()         ssd1306h_ContUpdateDisable(&hssd1306)
+#define ssd1306_SetRasterInt(...)           ssd1306h_SetRasterInt(&hssd1306, __VA_ARGS__)
+#define ssd1306_SetBandRenderer(...)        ssd1306h_SetBandRenderer(&hssd1306, __VA_ARGS__)
+#if SSD1306_DOUBLEBUF == 1
+#define ssd1306_Present()                   ssd1306h_Present(&hssd1306)
+#define ssd1306_TryPresent()                ssd1306h_TryPresent(&hssd1306)
+#define ssd1306_PresentPending()            ssd1306h_PresentPending(&hssd1306)
+#endif
+#if SSD1306_USE_DMA == 1 && SSD1306_CONTUPDATE == 0
+__weak void ssd1306_UpdateCompletedCallback(void); /* you can create a function for the end of the update (attention!: interrupt function) */
+#elif SSD1306_USE_DMA == 1 && SSD1306_CONTUPDATE == 1
+#define ssd1306_TryWriteCommands(...)       ssd1306h_TryWriteCommands(&hssd1306, __VA_ARGS__)
+#define ssd1306_TryWriteCommand(...)        ssd1306h_TryWriteCommand(&hssd1306, __VA_ARGS__)
+__weak void ssd1306_RasterIntCallback(uint8_t r); /* 0:At the beginning of PAGE0, 1:PAGE1, 2:PAGE2 ... 7:PAGE7 (attention!: interrupt function) */
 #endif
 
 #endif /* SSD1306_H_ */
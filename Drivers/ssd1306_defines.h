@@ -13,10 +13,41 @@
 #ifndef SSD1306_DEFINES_H_
 #define SSD1306_DEFINES_H_
 
+#ifndef SSD1306_I2C_PORT
 #define SSD1306_I2C_PORT  hi2c1   // I2C port as defined in main generated by CubeMx (hi2c1 or hi2c2 or hi2c3)
+#endif
+#ifndef SSD1306_ADDRESS
 #define SSD1306_ADDRESS    0x3C   // I2C address display
+#endif
+#if !defined(SSD1306_128X64) && !defined(SSD1306_128X32)
 #define SSD1306_128X64            // SSD1306_128X32 or SSD1306_128X64
+#endif
+#ifndef SSD1306_USE_DMA
 #define SSD1306_USE_DMA       0   // 0: not used I2C DMA mode, 1: used I2C DMA mode
+#endif
+#ifndef SSD1306_CONTUPDATE
 #define SSD1306_CONTUPDATE    0   // 0: continue update mode disable, 1: continue update mode enable (only DMA MODE)
+#endif
+#ifndef SSD1306_DOUBLEBUF
+#define SSD1306_DOUBLEBUF     0   // 0: one screen buffer, 1: drawing and DMA screen buffer, swap with ssd1306_Present (only DMA MODE)
+#endif
+#ifndef SSD1306_SHADOW
+#define SSD1306_SHADOW        0   // 0: send the changed spans, 1: copy of the displayed frame, the unchanged bytes are not sent (not in continue update mode)
+#endif
+#ifndef SSD1306_FONT_PAGES
+#define SSD1306_FONT_PAGES    1   // fonts: 0: row tables (pixel by pixel), 1: page-major tables (byte blit), 2: both (Tools/fonts)
+#endif
+#ifndef SSD1306_POLYGON_MAXVERTICES
+#define SSD1306_POLYGON_MAXVERTICES 32 // max vertices of ssd1306_FillPolygon (stack: 17 bytes / vertex)
+#endif
+#ifndef SSD1306_WIDGET_TEXTSIZE
+#define SSD1306_WIDGET_TEXTSIZE 16 // text of a label / unit of a value widget (chars + 1)
+#endif
+#ifndef SSD1306_STATS
+#define SSD1306_STATS         0   // 0: no statistics, 1: transfer statistics (ssd1306_GetStats)
+#endif
+#ifndef SSD1306_STATS_CLOCK
+#define SSD1306_STATS_CLOCK() HAL_GetTick() // clock of the frame time statistics (e.g. DWT->CYCCNT for CPU cycles)
+#endif
 
 #endif /* SSD1306_DEFINES_H_ */
@@ -0,0 +1,95 @@
+/*
+ * fontbench.c
+ *
+ *  Host benchmark of ssd1306_WriteChar: the row font path (DrawPixel for
+ *  every pixel) against the page-major font path (byte blit) and the packed
+ *  proportional font (bit stream -> cell -> blit), on a page aligned and on
+ *  an unaligned Y. The time of one char is printed in ns
+ *  and (on x86) in TSC cycles.
+ *
+ *  gcc -O2 -ITools/hostsim -IDrivers -DSSD1306_FONT_PAGES=2 Tools/fonts/fontbench.c Tools/hostsim/hal_sim.c Drivers/ssd1306.c Drivers/fonts.c -o fontbench -lpthread
+ *  ./fontbench
+ */
+
+#include "hal_sim.h"
+#include "ssd1306.h"
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES()  __rdtsc()
+#else
+#define CYCLES()  0
+#endif
+
+#if SSD1306_FONT_PAGES != 2
+#error fontbench needs both tables of the fonts (-DSSD1306_FONT_PAGES=2)
+#endif
+
+#define CHARS     200000
+
+static SSD1306_t dev;
+
+static uint64_t Now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+//
+//  Write CHARS chars on the line at y, return ns / char (cycles / char in *cycles)
+//
+static double Bench(FontDef font, uint8_t y, double *cycles)
+{
+  uint64_t t, c;
+  uint32_t i;
+  char ch = ' ';
+
+  t = Now();
+  c = CYCLES();
+  for (i = 0; i < CHARS; i++)
+  {
+    if (dev.CurrentX + font.FontWidth > SSD1306_WIDTH)
+      dev.CurrentX = 0;
+    dev.CurrentY = y;
+    ssd1306h_WriteChar(&dev, ch, font);
+    if (++ch > '~')
+      ch = ' ';
+  }
+  *cycles = (double)(CYCLES() - c) / CHARS;
+  return (double)(Now() - t) / CHARS;
+}
+
+int main(void)
+{
+  static const struct { const char *name; FontDef *font; FontDef *packed; } fonts[] = {
+    {"Font_6x8", &Font_6x8, &Font_6x8P}, {"Font_7x10", &Font_7x10, &Font_7x10P},
+    {"Font_11x18", &Font_11x18, &Font_11x18P}, {"Font_16x26", &Font_16x26, &Font_16x26P}
+  };
+  static const uint8_t ys[2] = {8, 11};
+  double ns_rows, ns_pages, ns_packed, cy_rows, cy_pages, cy_packed;
+  unsigned f, i;
+
+  // Only the screenbuffer is used, no display
+  dev.Buffer = dev.Buffers[0];
+  dev.Height = SSD1306_HEIGHT;
+  dev.Pages = SSD1306_HEIGHT / 8;
+  dev.Color = White;
+  ssd1306h_ResetClipRect(&dev);
+
+  printf("%-11s %4s %12s %12s %12s %12s %12s %12s %7s\n", "font", "y", "rows ns", "pages ns", "packed ns", "rows cyc", "pages cyc", "packed cyc", "speedup");
+  for (f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++)
+  {
+    FontDef rows = {fonts[f].font->FontWidth, fonts[f].font->FontHeight, fonts[f].font->data, NULL, NULL};
+    for (i = 0; i < 2; i++)
+    {
+      ns_rows = Bench(rows, ys[i], &cy_rows);
+      ns_pages = Bench(*fonts[f].font, ys[i], &cy_pages);
+      ns_packed = Bench(*fonts[f].packed, ys[i], &cy_packed);
+      printf("%-11s %4u %12.1f %12.1f %12.1f %12.0f %12.0f %12.0f %6.1fx\n", fonts[f].name, ys[i], ns_rows, ns_pages, ns_packed,
+             cy_rows, cy_pages, cy_packed, ns_rows / ns_pages);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,427 @@
+/*
+ * fontconv.c
+ *
+ *  Converts the row fonts of fonts.c (uint16_t rows, bit 15: left column)
+ *  to the page-major font format of the byte blitter: for every char, for
+ *  every 8-row page of the glyph, one byte per column (bit 0: top row),
+ *  the rows below the font height are 0. The output is C source, paste it
+ *  into fonts.c and give the table to the FontDef (4th member).
+ *  With -p the packed proportional fonts are made (FontPacked: cropped glyph
+ *  boxes as bit streams, the code point ranges, the FontDef is printed too),
+ *  with some extra glyphs (degree sign, micro sign).
+ *  With -b a packed font is made of the glyphs of a BDF font in the code
+ *  point ranges (e.g. Cyrillic, symbols, icons; max 32 x 32 pixels).
+ *
+ *  gcc -O2 -IDrivers -DSSD1306_FONT_PAGES=2 Tools/fonts/fontconv.c Drivers/fonts.c -o fontconv
+ *  ./fontconv > pages.c
+ *  ./fontconv -p > packed.c
+ *  ./fontconv -b Font6x13C Font_6x13C 6x13.bdf 32-126,0xB0,0x410-0x44F > cyrillic.c
+ */
+
+#include "fonts.h"
+#include "ssd1306_defines.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if SSD1306_FONT_PAGES != 2
+#error fontconv needs the row tables of fonts.c (-DSSD1306_FONT_PAGES=2)
+#endif
+
+static void Convert(const char *name, const FontDef *font)
+{
+  int pages = (font->FontHeight + 7) / 8;
+  int ch, page, col, row, i;
+  uint8_t b;
+  uint16_t r;
+
+  printf("static const uint8_t %s_Pages [] = {\n", name);
+  for (ch = 0; ch < 95; ch++)
+  {
+    for (page = 0; page < pages; page++)
+    {
+      for (col = 0; col < font->FontWidth; col++)
+      {
+        b = 0;
+        for (i = 0; i < 8; i++)
+        {
+          row = page * 8 + i;
+          if (row >= font->FontHeight)
+            break;
+          r = font->data[ch * font->FontHeight + row];
+          if ((r << col) & 0x8000)
+            b |= 1 << i;
+        }
+        printf("0x%02X,", b);
+      }
+    }
+    if (ch == 0)
+      printf("  // sp\n");
+    else if (ch + 32 == '\\')
+      printf("  // backslash\n");
+    else
+      printf("  // %c\n", ch + 32);
+  }
+  printf("};\n\n");
+}
+
+//
+//  Glyphs of a packed font (collected, then sorted by code point)
+//
+#define MAXGLYPHS  2048
+
+typedef struct {
+  uint32_t cp;
+  int width, height, xoff, yoff, advance;
+  uint32_t cols[32];          /* columns of the box, bit 0: top row of the box */
+} Glyph;
+
+static Glyph glyph[MAXGLYPHS];
+static int glyphs;
+
+//
+//  Extra glyphs of the packed fonts ('#': set pixel, the first string is the
+//  row 'top' of the cell)
+//
+typedef struct {
+  uint32_t cp;
+  int top;
+  const char *rows[24];
+} Extra;
+
+static const Extra Extra6x8[] = {
+  {0x00B0, 0, {".##.", "#..#", "#..#", ".##."}},                                  /* degree sign */
+  {0x00B5, 2, {"#...#", "#...#", "#...#", "#..##", "###.#", "#...."}},            /* micro sign */
+  {0}
+};
+
+static const Extra Extra7x10[] = {
+  {0x00B0, 0, {".##.", "#..#", "#..#", ".##."}},
+  {0x00B5, 2, {"#...#", "#...#", "#...#", "#...#", "#..##", "###.#", "#....", "#...."}},
+  {0}
+};
+
+static const Extra Extra11x18[] = {
+  {0x00B0, 1, {"..##..", ".####.", "##..##", "##..##", ".####.", "..##.."}},
+  {0x00B5, 5, {"##....##", "##....##", "##....##", "##....##", "##....##", "##....##",
+               "##....##", "##...###", "########", "#####.##", "##......", "##......", "##......"}},
+  {0}
+};
+
+static const Extra Extra16x26[] = {
+  {0x00B0, 0, {"...####...", "..######..", ".###..###.", "###....###", "###....###",
+               "###....###", "###....###", ".###..###.", "..######..", "...####..."}},
+  {0x00B5, 6, {"####.....####", "####.....####", "####.....####", "####.....####",
+               "####.....####", "####.....####", "####.....####", "####.....####",
+               "####.....####", "####.....####", "####....#####", "####...######",
+               "#####.#######", "#############", "########.####", "####.........",
+               "####.........", "####.........", "####.........", "####........."}},
+  {0}
+};
+
+//
+//  Add a glyph: rows of the cell (bit 0: left column), the box of the set
+//  pixels is cropped. bearing 0: the left bearing is dropped and the advance
+//  is the box width + 1 (empty glyph: the given advance), bearing 1: the box
+//  stays in its place, the advance is given (at least up to the box).
+//
+static int AddGlyph(uint32_t cp, const uint32_t *rows, int height, int advance, int bearing)
+{
+  Glyph *g = &glyph[glyphs];
+  int col, row, x0 = 32, x1 = -1, y0 = height, y1 = -1;
+
+  if (glyphs >= MAXGLYPHS)
+    return -1;
+  memset(g, 0, sizeof(*g));
+  for (row = 0; row < height; row++)
+  {
+    for (col = 0; col < 32; col++)
+    {
+      if ((rows[row] >> col) & 1)
+      {
+        if (col < x0) x0 = col;
+        if (col > x1) x1 = col;
+        if (row < y0) y0 = row;
+        if (row > y1) y1 = row;
+      }
+    }
+  }
+  g->cp = cp;
+  g->advance = advance;
+  if (x1 >= 0)
+  {
+    g->width = x1 - x0 + 1;
+    g->height = y1 - y0 + 1;
+    g->yoff = y0;
+    if (bearing)
+    {
+      g->xoff = x0;
+      if (g->advance < x1 + 1)
+        g->advance = x1 + 1;
+    }
+    else
+      g->advance = g->width + 1;
+    for (col = x0; col <= x1; col++)
+      for (row = y0; row <= y1; row++)
+        if ((rows[row] >> col) & 1)
+          g->cols[col - x0] |= 1U << (row - y0);
+  }
+  if (g->advance < 1 || g->advance > 32)
+    return -1;
+  glyphs++;
+  return 0;
+}
+
+//
+//  The glyphs of a row font (' ' .. '~') and its extra glyphs
+//
+static void AddRowFont(const FontDef *font, const Extra *extra)
+{
+  uint32_t rows[32];
+  int ch, row, col, i;
+
+  for (ch = 0; ch < 95; ch++)
+  {
+    for (row = 0; row < font->FontHeight; row++)
+    {
+      rows[row] = 0;
+      for (col = 0; col < font->FontWidth; col++)
+        if ((font->data[ch * font->FontHeight + row] << col) & 0x8000)
+          rows[row] |= 1U << col;
+    }
+    AddGlyph(ch + 32, rows, font->FontHeight, font->FontWidth / 2, 0);
+  }
+  for (; extra->cp; extra++)
+  {
+    memset(rows, 0, sizeof(rows));
+    for (i = 0; extra->rows[i] != NULL; i++)
+      for (col = 0; extra->rows[i][col]; col++)
+        if (extra->rows[i][col] == '#')
+          rows[extra->top + i] |= 1U << col;
+    AddGlyph(extra->cp, rows, font->FontHeight, 0, 0);
+  }
+}
+
+//
+//  Code point ranges ("32-126,0xB0,0x410-0x44F")
+//
+static int InRanges(const char *ranges, uint32_t cp)
+{
+  char *end;
+  unsigned long first, last;
+
+  while (*ranges)
+  {
+    first = last = strtoul(ranges, &end, 0);
+    if (*end == '-')
+      last = strtoul(end + 1, &end, 0);
+    if (cp >= first && cp <= last)
+      return 1;
+    if (*end != ',')
+      break;
+    ranges = end + 1;
+  }
+  return 0;
+}
+
+//
+//  The glyphs of a BDF font in the ranges (the cell: FONT_ASCENT + FONT_DESCENT
+//  rows, the advance: DWIDTH, the left bearing is kept)
+//  returns the font height, -1: error
+//
+static int ReadBDF(const char *path, const char *ranges)
+{
+  FILE *f = fopen(path, "r");
+  char line[256];
+  uint32_t rows[32];
+  int ascent = -1, descent = -1, fbw, fbh, fbx, fby, height = 0;
+  int enc = -1, dwidth = 0, w = 0, h = 0, xo = 0, yo = 0, bitmap = -1, row, col, bits;
+  unsigned long v;
+
+  if (f == NULL)
+    return -1;
+  while (fgets(line, sizeof(line), f) != NULL)
+  {
+    if (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &fbw, &fbh, &fbx, &fby) == 4)
+    {
+      if (ascent < 0) ascent = fbh + fby;
+      if (descent < 0) descent = -fby;
+    }
+    else if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1 || sscanf(line, "FONT_DESCENT %d", &descent) == 1)
+    { }
+    else if (strncmp(line, "STARTCHAR", 9) == 0)
+    {
+      height = ascent + descent;
+      if (height < 1 || height > 32)
+        return -1;
+      enc = -1;
+      bitmap = -1;
+      memset(rows, 0, sizeof(rows));
+    }
+    else if (sscanf(line, "ENCODING %d", &enc) == 1 || sscanf(line, "DWIDTH %d", &dwidth) == 1 ||
+             sscanf(line, "BBX %d %d %d %d", &w, &h, &xo, &yo) == 4)
+    { }
+    else if (strncmp(line, "BITMAP", 6) == 0)
+      bitmap = 0;
+    else if (strncmp(line, "ENDCHAR", 7) == 0)
+    {
+      if (enc >= 0 && InRanges(ranges, enc) && AddGlyph(enc, rows, height, dwidth, 1))
+      {
+        fprintf(stderr, "U+%04X: glyph too wide\n", enc);
+        return -1;
+      }
+      bitmap = -1;
+    }
+    else if (bitmap >= 0 && bitmap < h)
+    { /* hex row of the box, MSB: left column */
+      v = strtoul(line, NULL, 16);
+      bits = strspn(line, "0123456789abcdefABCDEF") * 4;
+      row = ascent - (yo + h) + bitmap++;
+      for (col = 0; col < w && col < bits; col++)
+      {
+        if (!((v >> (bits - 1 - col)) & 1))
+          continue;
+        if (row < 0 || row >= height || xo + col < 0 || xo + col >= 32)
+        {
+          fprintf(stderr, "U+%04X: pixel outside of the cell\n", enc);
+          return -1;
+        }
+        rows[row] |= 1U << (xo + col);
+      }
+    }
+  }
+  fclose(f);
+  return height;
+}
+
+static int CompareGlyphs(const void *a, const void *b)
+{
+  uint32_t x = ((const Glyph *)a)->cp, y = ((const Glyph *)b)->cp;
+  return (x > y) - (x < y);
+}
+
+static void Comment(uint32_t cp)
+{
+  if (cp == ' ')
+    printf("  // sp\n");
+  else if (cp == '\\')
+    printf("  // backslash\n");
+  else if (cp > ' ' && cp < 127)
+    printf("  // %c\n", cp);
+  else
+    printf("  // U+%04X\n", cp);
+}
+
+//
+//  Packed proportional font of the collected glyphs: the columns of the box
+//  are written as a bit stream (LSB first), the consecutive code points give
+//  the ranges (sparse sets: a binary search over the ranges)
+//
+static int Emit(const char *name, const char *fontname, int height)
+{
+  int i, col, row, nacc, bytes = 0, ranges = 0, maxadvance = 0;
+  int offset[MAXGLYPHS];
+  uint32_t acc;
+
+  qsort(glyph, glyphs, sizeof(Glyph), CompareGlyphs);
+  for (i = 1; i < glyphs; i++)
+  {
+    if (glyph[i].cp == glyph[i - 1].cp)
+    {
+      fprintf(stderr, "U+%04X: two glyphs\n", glyph[i].cp);
+      return -1;
+    }
+  }
+
+  printf("static const uint8_t %s_Bits [] = {\n", name);
+  for (i = 0; i < glyphs; i++)
+  {
+    offset[i] = bytes;
+    acc = 0;
+    nacc = 0;
+    for (col = 0; col < glyph[i].width; col++)
+    {
+      for (row = 0; row < glyph[i].height; row++)
+      {
+        if ((glyph[i].cols[col] >> row) & 1)
+          acc |= 1 << nacc;
+        if (++nacc == 8)
+        {
+          printf("0x%02X,", acc);
+          bytes++;
+          acc = 0;
+          nacc = 0;
+        }
+      }
+    }
+    if (nacc)
+    {
+      printf("0x%02X,", acc);
+      bytes++;
+    }
+    Comment(glyph[i].cp);
+    if (glyph[i].advance > maxadvance)
+      maxadvance = glyph[i].advance;
+  }
+  printf("};\n\n");
+
+  printf("static const FontGlyph %s_Glyphs [] = {\n", name);
+  for (i = 0; i < glyphs; i++)
+  {
+    printf("  {%4d, %2d, %2d, %d, %2d, %2d},", offset[i], glyph[i].width, glyph[i].height,
+           glyph[i].xoff, glyph[i].yoff, glyph[i].advance);
+    Comment(glyph[i].cp);
+  }
+  printf("};\n\n");
+
+  printf("static const FontRange %s_Ranges [] = {\n", name);
+  for (i = 0; i < glyphs; i++)
+  {
+    col = i;
+    while (i + 1 < glyphs && glyph[i + 1].cp == glyph[i].cp + 1)
+      i++;
+    printf("  {0x%04X, %3d, %3d},\n", glyph[col].cp, i - col + 1, col);
+    ranges++;
+  }
+  printf("};\n\n");
+
+  printf("// %d glyphs: %d bytes of bits + %d bytes of glyphs + %d bytes of ranges\n", glyphs, bytes,
+         (int)(glyphs * sizeof(FontGlyph)), (int)(ranges * sizeof(FontRange)));
+  printf("static const FontPacked %s_Packed = {%d, %s_Ranges, %s_Glyphs, %s_Bits};\n", name, ranges, name, name, name);
+  printf("FontDef %s = {%d,%d,NULL,NULL,&%s_Packed};\n\n", fontname, maxadvance, height, name);
+  glyphs = 0;
+  return 0;
+}
+
+static void Pack(const char *name, const char *fontname, const FontDef *font, const Extra *extra)
+{
+  AddRowFont(font, extra);
+  Emit(name, fontname, font->FontHeight);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1 && strcmp(argv[1], "-p") == 0)
+  {
+    Pack("Font6x8P", "Font_6x8P", &Font_6x8, Extra6x8);
+    Pack("Font7x10P", "Font_7x10P", &Font_7x10, Extra7x10);
+    Pack("Font11x18P", "Font_11x18P", &Font_11x18, Extra11x18);
+    Pack("Font16x26P", "Font_16x26P", &Font_16x26, Extra16x26);
+    return 0;
+  }
+  if (argc == 6 && strcmp(argv[1], "-b") == 0)
+  {
+    int height = ReadBDF(argv[4], argv[5]);
+    if (height < 0 || glyphs == 0)
+    {
+      fprintf(stderr, "%s: cannot read the font %s\n", argv[0], argv[4]);
+      return 1;
+    }
+    return Emit(argv[2], argv[3], height) ? 1 : 0;
+  }
+  Convert("Font6x8", &Font_6x8);
+  Convert("Font7x10", &Font_7x10);
+  Convert("Font11x18", &Font_11x18);
+  Convert("Font16x26", &Font_16x26);
+  return 0;
+}
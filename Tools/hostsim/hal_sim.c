@@ -0,0 +1,657 @@
+/*
+ * hal_sim.c
+ *
+ *  Host simulator of the I2C HAL and of SSD1306 displays (see hal_sim.h)
+ */
+
+#define _GNU_SOURCE
+#include "hal_sim.h"
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define SIM_BUSES      3
+#define SIM_PANELS     8
+
+static I2C_TypeDef I2C1_Instance = {1}, I2C2_Instance = {2}, I2C3_Instance = {3};
+I2C_HandleTypeDef hi2c1 = {&I2C1_Instance, HAL_I2C_STATE_READY};
+I2C_HandleTypeDef hi2c2 = {&I2C2_Instance, HAL_I2C_STATE_READY};
+I2C_HandleTypeDef hi2c3 = {&I2C3_Instance, HAL_I2C_STATE_READY};
+
+static I2C_HandleTypeDef *sim_bus[SIM_BUSES] = {&hi2c1, &hi2c2, &hi2c3};
+static sim_counters sim_cnt[SIM_BUSES];
+static sim_panel sim_panels[SIM_PANELS];
+static int sim_npanels = 0;
+
+// DMA transfer in progress on every bus
+static struct {
+  uint16_t dev, mem;
+  uint8_t *data;
+  uint16_t size;
+  uint64_t end;                   // virtual time of the end of the transfer
+  volatile uint8_t done;
+} sim_dma[SIM_BUSES];
+
+static sem_t sim_dmasem;
+static pthread_t sim_mainthread;
+static double sim_scale = 0;
+
+// Virtual time (us), only changed by the main thread (also in the signal handler)
+static volatile uint64_t sim_time = 0;
+
+static uint64_t sim_alarmtime;
+static void (*sim_alarm)(void) = NULL;
+
+void (*sim_DelayHook)(uint32_t ms) = NULL;
+
+//-----------------------------------------------------------------------------
+// Interrupt emulation (SIGUSR1 of the main thread)
+// PRIMASK is emulated: 1 blocks the signal. In the "interrupt" the signal stays
+// blocked also with PRIMASK 0 (as on the Cortex-M an interrupt does not preempt
+// itself), at its end PRIMASK is restored.
+
+static volatile uint32_t sim_primask = 0;
+static volatile int sim_inirq = 0;
+
+static void sim_Irq(int enable)
+{
+  sigset_t s;
+  sigemptyset(&s);
+  sigaddset(&s, SIGUSR1);
+  sim_primask = !enable;
+  if (enable && sim_inirq)
+    return;
+  pthread_sigmask(enable ? SIG_UNBLOCK : SIG_BLOCK, &s, NULL);
+}
+
+void __disable_irq(void) { sim_Irq(0); }
+void __enable_irq(void)  { sim_Irq(1); }
+uint32_t __get_PRIMASK(void) { return sim_primask; }
+void __set_PRIMASK(uint32_t priMask) { sim_Irq(!(priMask & 1)); }
+
+// Begin / end of the interrupt context
+static uint32_t sim_IrqEnter(void)
+{
+  sim_inirq++;
+  return sim_primask;
+}
+
+static void sim_IrqLeave(uint32_t primask)
+{
+  sim_inirq--;
+  sim_primask = primask;
+}
+
+//-----------------------------------------------------------------------------
+// Virtual time
+
+//
+//  Advance the virtual time (interrupts are disabled by the caller)
+//
+static void sim_TimeTo(uint64_t t)
+{
+  void (*fn)(void);
+  uint32_t pm;
+  if (t > sim_time)
+    sim_time = t;
+  if (sim_alarm != NULL && sim_time >= sim_alarmtime)
+  {
+    fn = sim_alarm;
+    sim_alarm = NULL;
+    pm = sim_IrqEnter();
+    fn();
+    sim_IrqLeave(pm);
+  }
+}
+
+static void sim_Advance(uint64_t us)
+{
+  uint32_t pm = __get_PRIMASK();
+  __disable_irq();
+  sim_TimeTo(sim_time + us);
+  __set_PRIMASK(pm);
+}
+
+uint64_t sim_Time(void)
+{
+  return sim_time;
+}
+
+void sim_SetAlarm(uint64_t t, void (*fn)(void))
+{
+  uint32_t pm = __get_PRIMASK();
+  __disable_irq();
+  sim_alarmtime = t;
+  sim_alarm = fn;
+  __set_PRIMASK(pm);
+}
+
+// Modelled duration of an I2C transfer: address, control byte and data, 9 clocks per byte
+static uint64_t sim_Duration(uint16_t size)
+{
+  return (uint64_t)(2 + size) * 9 * 1000000 / SIM_I2C_CLOCK;
+}
+
+//-----------------------------------------------------------------------------
+// Emulated display
+
+static int sim_BusIndex(I2C_HandleTypeDef *hi2c)
+{
+  int b;
+  for (b = 0; b < SIM_BUSES; b++)
+    if (sim_bus[b]->Instance == hi2c->Instance)
+      return b;
+  return 0;
+}
+
+sim_panel *sim_GetPanel(I2C_HandleTypeDef *bus, uint8_t addr7)
+{
+  int i;
+  for (i = 0; i < sim_npanels; i++)
+    if (sim_panels[i].bus->Instance == bus->Instance && sim_panels[i].addr == addr7)
+      return &sim_panels[i];
+  return NULL;
+}
+
+//
+//  Add a display to the bus (power on reset state)
+//
+sim_panel *sim_AddPanel(I2C_HandleTypeDef *bus, uint8_t addr7)
+{
+  sim_panel *p;
+  if (sim_npanels >= SIM_PANELS)
+    return NULL;
+  p = &sim_panels[sim_npanels++];
+  memset(p, 0, sizeof(*p));
+  p->bus = bus;
+  p->addr = addr7;
+  p->mode = 2;
+  p->colend = 127;
+  p->pageend = 7;
+  p->mux = 63;
+  p->contrast = 0x7F;
+  p->clockdiv = 0x80;
+  p->precharge = 0x22;
+  p->vrows = 64;
+  return p;
+}
+
+// Number of parameter bytes of the commands
+static uint8_t sim_Params(uint8_t c)
+{
+  switch (c)
+  {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+      return 1;
+    case 0x21: case 0x22: case 0xA3:
+      return 2;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0x26: case 0x27:
+      return 6;
+  }
+  return 0;
+}
+
+//
+//  Approximate frame period of the display (us)
+//  Frame frequency = Fosc / (D * K * MUX), K = phase1 + phase2 + 50 DCLK
+//  Fosc is about 370 kHz at the reset value and grows with the setting.
+//
+static uint64_t sim_FramePeriod(sim_panel *p)
+{
+  double fosc = 370000.0 + ((int)(p->clockdiv >> 4) - 8) * 20000.0;
+  uint32_t d = (p->clockdiv & 0x0F) + 1;
+  uint32_t k = (p->precharge & 0x0F) + (p->precharge >> 4) + 50;
+  return (uint64_t)(1e6 * d * k * (p->mux + 1) / fosc);
+}
+
+// Scroll step interval in frames (0x26, 0x27, 0x29, 0x2A interval setting)
+static const uint16_t sim_ScrollFrames[8] = {5, 64, 128, 256, 3, 4, 25, 2};
+
+//
+//  Do the scroll steps due until the virtual time
+//  Horizontal scroll rotates the RAM of the scrolled pages (as the display does),
+//  vertical scroll moves the rows of the vertical scroll area.
+//
+static void sim_Scroll(sim_panel *p)
+{
+  uint8_t pg, right, t;
+  uint64_t step;
+
+  if (!p->scrolling)
+    return;
+  step = sim_ScrollFrames[p->sinterval & 7] * sim_FramePeriod(p);
+  right = (p->scrollcmd == 0x26 || p->scrollcmd == 0x29) ^ p->remap;
+  while (p->scrolltime <= sim_time)
+  {
+    for (pg = p->sstart; pg <= p->send && pg < 8; pg++)
+    {
+      if (right)
+      {
+        t = p->ram[pg][127];
+        memmove(&p->ram[pg][1], &p->ram[pg][0], 127);
+        p->ram[pg][0] = t;
+      }
+      else
+      {
+        t = p->ram[pg][0];
+        memmove(&p->ram[pg][0], &p->ram[pg][1], 127);
+        p->ram[pg][127] = t;
+      }
+    }
+    if ((p->scrollcmd == 0x29 || p->scrollcmd == 0x2A) && p->vrows)
+      p->vscroll = (p->vscroll + p->svoffset) % p->vrows;
+    p->scrolltime += step;
+  }
+}
+
+static void sim_Command(sim_panel *p)
+{
+  uint8_t c = p->cmd;
+  uint8_t *a = p->args;
+
+  if (c <= 0x0F)                     p->col = (p->col & 0xF0) | c;
+  else if (c <= 0x1F)                p->col = (p->col & 0x0F) | ((c & 0x07) << 4);
+  else if (c == 0x20)                p->mode = a[0] & 3;
+  else if (c == 0x21)                { p->colstart = a[0] & 127; p->colend = a[1] & 127; p->col = p->colstart; }
+  else if (c == 0x22)                { p->pagestart = a[0] & 7; p->pageend = a[1] & 7; p->page = p->pagestart; }
+  else if (c == 0x26 || c == 0x27)   { p->scrollcmd = c; p->sstart = a[1] & 7; p->sinterval = a[2] & 7; p->send = a[3] & 7; p->svoffset = 0; }
+  else if (c == 0x29 || c == 0x2A)   { p->scrollcmd = c; p->sstart = a[1] & 7; p->sinterval = a[2] & 7; p->send = a[3] & 7; p->svoffset = a[4] & 63; }
+  else if (c == 0x2E)                p->scrolling = 0;
+  else if (c == 0x2F)                { p->scrolling = 1; p->scrolltime = sim_time + sim_ScrollFrames[p->sinterval & 7] * sim_FramePeriod(p); }
+  else if (c >= 0x40 && c <= 0x7F)   p->startline = c & 63;
+  else if (c == 0x81)                p->contrast = a[0];
+  else if (c == 0xA0 || c == 0xA1)   p->remap = c & 1;
+  else if (c == 0xA3)                { p->vfixed = a[0] & 63; p->vrows = a[1] & 127; p->vscroll = 0; }
+  else if (c == 0xA4 || c == 0xA5)   p->allon = c & 1;
+  else if (c == 0xA6 || c == 0xA7)   p->invert = c & 1;
+  else if (c == 0xA8)                p->mux = (a[0] & 63) < 15 ? 15 : (a[0] & 63);
+  else if (c == 0xAE || c == 0xAF)   p->on = c & 1;
+  else if (c >= 0xB0 && c <= 0xB7)   p->page = c & 7;
+  else if (c == 0xC0 || c == 0xC8)   p->comdec = (c == 0xC8);
+  else if (c == 0xD3)                p->offset = a[0] & 63;
+  else if (c == 0xD5)                p->clockdiv = a[0];
+  else if (c == 0xD9)                p->precharge = a[0];
+}
+
+static void sim_CommandByte(sim_panel *p, uint8_t b)
+{
+  if (p->need)
+  { /* parameter */
+    p->args[p->argc++] = b;
+    if (--p->need == 0)
+      sim_Command(p);
+    return;
+  }
+  p->cmd = b;
+  p->argc = 0;
+  p->need = sim_Params(b);
+  if (p->need == 0)
+    sim_Command(p);
+}
+
+//
+//  The RAM pointer wrapped to the start of the address window
+//
+static void sim_Wrapped(sim_panel *p)
+{
+  p->frames++;
+  if (p->colstart == 0 && p->colend == 127 && p->pagestart == 0 && p->pageend >= (p->mux >> 3))
+    p->screens++;
+}
+
+static void sim_DataByte(sim_panel *p, uint8_t b)
+{
+  if (p->scrolling)
+    p->ramwrites_scrolling++;
+  p->ram[p->page & 7][p->col & 127] = b;
+  if (p->mode == 0)
+  { /* horizontal addressing mode */
+    if (p->col >= p->colend)
+    {
+      p->col = p->colstart;
+      if (p->page >= p->pageend)
+      {
+        p->page = p->pagestart;
+        sim_Wrapped(p);
+      }
+      else
+        p->page++;
+    }
+    else
+      p->col++;
+  }
+  else if (p->mode == 1)
+  { /* vertical addressing mode */
+    if (p->page >= p->pageend)
+    {
+      p->page = p->pagestart;
+      if (p->col >= p->colend)
+      {
+        p->col = p->colstart;
+        sim_Wrapped(p);
+      }
+      else
+        p->col++;
+    }
+    else
+      p->page++;
+  }
+  else
+  { /* page addressing mode: the column pointer stops at the end of the page */
+    if (p->col < 127)
+      p->col++;
+  }
+}
+
+//
+//  One I2C transaction: address, control byte (MemAddress), data
+//
+static void sim_Transfer(I2C_HandleTypeDef *hi2c, uint16_t dev, uint16_t mem, const uint8_t *data, uint16_t size)
+{
+  int b = sim_BusIndex(hi2c);
+  sim_panel *p = sim_GetPanel(hi2c, dev >> 1);
+  uint16_t i;
+
+  sim_cnt[b].transactions++;
+  sim_cnt[b].wire_bytes += 2 + size;
+  if (mem == 0x00)
+    sim_cnt[b].cmd_bytes += size;
+  else
+    sim_cnt[b].data_bytes += size;
+  if (p == NULL)
+    return;
+
+  sim_Scroll(p);
+  for (i = 0; i < size; i++)
+  {
+    if (mem == 0x00)
+      sim_CommandByte(p, data[i]);
+    else
+      sim_DataByte(p, data[i]);
+  }
+}
+
+//
+//  "Interrupt": end of the DMA transfers
+//
+static void sim_DmaIrq(int sig)
+{
+  int b;
+  uint32_t pm = sim_IrqEnter();
+  (void)sig;
+  for (b = 0; b < SIM_BUSES; b++)
+  {
+    if (sim_dma[b].done)
+    {
+      sim_dma[b].done = 0;
+      sim_Transfer(sim_bus[b], sim_dma[b].dev, sim_dma[b].mem, sim_dma[b].data, sim_dma[b].size);
+      sim_TimeTo(sim_dma[b].end);
+      sim_cnt[b].irqs++;
+      sim_bus[b]->State = HAL_I2C_STATE_READY;
+      HAL_I2C_MemTxCpltCallback(sim_bus[b]);
+    }
+  }
+  sim_IrqLeave(pm);
+}
+
+//
+//  DMA controller: waits for the (scaled) duration of the transfer, then raises the interrupt
+//
+static void *sim_DmaThread(void *arg)
+{
+  int b;
+  double us;
+  struct timespec ts;
+  (void)arg;
+  for (;;)
+  {
+    while (sem_wait(&sim_dmasem) != 0) { };
+    for (b = 0; b < SIM_BUSES; b++)
+    {
+      if (sim_bus[b]->State != HAL_I2C_STATE_BUSY_TX || sim_dma[b].done)
+        continue;
+      us = sim_Duration(sim_dma[b].size) * sim_scale;
+      if (us >= 1)
+      {
+        ts.tv_sec = (time_t)(us / 1e6);
+        ts.tv_nsec = (long)((us - ts.tv_sec * 1e6) * 1000);
+        nanosleep(&ts, NULL);
+      }
+      sim_dma[b].done = 1;
+      pthread_kill(sim_mainthread, SIGUSR1);
+    }
+  }
+  return NULL;
+}
+
+void sim_Init(double time_scale)
+{
+  struct sigaction sa;
+  pthread_t t;
+
+  sim_scale = time_scale;
+  sim_mainthread = pthread_self();
+  sem_init(&sim_dmasem, 0, 0);
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = sim_DmaIrq;
+  sa.sa_flags = SA_RESTART;
+  sigaction(SIGUSR1, &sa, NULL);
+  pthread_create(&t, NULL, sim_DmaThread, NULL);
+}
+
+sim_counters sim_GetCounters(I2C_HandleTypeDef *bus)
+{
+  return sim_cnt[sim_BusIndex(bus)];
+}
+
+void sim_ResetCounters(void)
+{
+  memset(sim_cnt, 0, sizeof(sim_cnt));
+}
+
+int sim_Settle(void)
+{
+  uint32_t screens[SIM_PANELS];
+  struct timespec ts = {0, 20000};
+  int i, b, busy, waiting, n;
+
+  for (i = 0; i < sim_npanels; i++)
+    screens[i] = sim_panels[i].screens;
+  for (n = 0; n < 100000; n++)
+  {
+    busy = 0;
+    for (b = 0; b < SIM_BUSES; b++)
+      if (sim_bus[b]->State != HAL_I2C_STATE_READY)
+        busy = 1;
+    if (!busy)
+      return 0;
+    waiting = 0;
+    for (i = 0; i < sim_npanels; i++)
+      if (sim_panels[i].screens - screens[i] < 2)
+        waiting = 1;
+    if (!waiting)
+      return 0;
+    nanosleep(&ts, NULL);
+  }
+  return -1;
+}
+
+uint8_t sim_RamByte(sim_panel *p, uint8_t page, uint8_t col)
+{
+  return p->ram[page & 7][col & 127];
+}
+
+uint8_t sim_Height(sim_panel *p)
+{
+  return p->mux + 1;
+}
+
+//
+//  Visible picture: row y is driven by COMy (or COM[mux - y] if the scan is remapped),
+//  it shows the RAM row (COM + start line + offset), column x shows SEGx (or SEG[127 - x])
+//
+uint8_t sim_Render(sim_panel *p, uint8_t img[64][128])
+{
+  uint8_t x, y, com, row, bit;
+  uint32_t pm = __get_PRIMASK();
+
+  __disable_irq();
+  sim_Scroll(p);
+  for (y = 0; y <= p->mux; y++)
+  {
+    com = p->comdec ? p->mux - y : y;
+    if (p->vrows && com >= p->vfixed && com < p->vfixed + p->vrows)
+      com = p->vfixed + (com - p->vfixed + p->vscroll) % p->vrows;
+    row = (com + p->startline + p->offset) & 63;
+    for (x = 0; x < 128; x++)
+    {
+      bit = (p->ram[row >> 3][p->remap ? 127 - x : x] >> (row & 7)) & 1;
+      if (p->allon)
+        bit = 1;
+      else
+        bit ^= p->invert;
+      img[y][x] = p->on ? bit : 0;
+    }
+  }
+  __set_PRIMASK(pm);
+  return p->mux + 1;
+}
+
+//
+//  Save the picture in binary PBM format (1: white pixel)
+//
+int sim_WritePBM(uint8_t img[64][128], uint8_t rows, const char *path)
+{
+  uint8_t b;
+  int x, y, i;
+  FILE *f = fopen(path, "wb");
+  if (f == NULL)
+    return -1;
+  fprintf(f, "P4\n128 %d\n", rows);
+  for (y = 0; y < rows; y++)
+  {
+    for (x = 0; x < 128; x += 8)
+    {
+      b = 0;
+      for (i = 0; i < 8; i++)
+        b = (b << 1) | img[y][x + i];
+      fputc(b, f);
+    }
+  }
+  fclose(f);
+  return 0;
+}
+
+int sim_ComparePBM(uint8_t img[64][128], uint8_t rows, const char *path)
+{
+  int w, h, c, x, y, i, diff = 0;
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+    return -1;
+  if (fscanf(f, "P4 %d %d", &w, &h) != 2 || w != 128 || h != rows || fgetc(f) == EOF)
+  {
+    fclose(f);
+    return -1;
+  }
+  for (y = 0; y < h; y++)
+  {
+    for (x = 0; x < 128; x += 8)
+    {
+      if ((c = fgetc(f)) == EOF)
+      {
+        fclose(f);
+        return -1;
+      }
+      for (i = 0; i < 8; i++)
+        diff += ((c >> (7 - i)) & 1) != img[y][x + i];
+    }
+  }
+  fclose(f);
+  return diff;
+}
+
+//-----------------------------------------------------------------------------
+// HAL functions
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout)
+{
+  return sim_GetPanel(hi2c, DevAddress >> 1) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+  uint32_t pm = __get_PRIMASK();
+
+  if (hi2c->State != HAL_I2C_STATE_READY)
+    return HAL_BUSY;
+  __disable_irq();
+  sim_Transfer(hi2c, DevAddress, MemAddress, pData, Size);
+  sim_TimeTo(sim_time + sim_Duration(Size));
+  __set_PRIMASK(pm);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+  int b = sim_BusIndex(hi2c);
+  sigset_t s, old;
+
+  sigemptyset(&s);
+  sigaddset(&s, SIGUSR1);
+  pthread_sigmask(SIG_BLOCK, &s, &old);
+  if (hi2c->State != HAL_I2C_STATE_READY)
+  {
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    return HAL_BUSY;
+  }
+  hi2c->State = HAL_I2C_STATE_BUSY_TX;
+  sim_dma[b].dev = DevAddress;
+  sim_dma[b].mem = MemAddress;
+  sim_dma[b].data = pData;
+  sim_dma[b].size = Size;
+  sim_dma[b].end = sim_time + sim_Duration(Size);
+  sem_post(&sim_dmasem);
+  pthread_sigmask(SIG_SETMASK, &old, NULL);
+  return HAL_OK;
+}
+
+HAL_I2C_StateTypeDef HAL_I2C_GetState(I2C_HandleTypeDef *hi2c)
+{
+  return hi2c->State;
+}
+
+//
+//  Every query costs 1 us of virtual time, so the polling loops end
+//
+uint32_t HAL_GetTick(void)
+{
+  sim_Advance(1);
+  return (uint32_t)(sim_time / 1000);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+  struct timespec ts;
+  double us = Delay * 1000.0 * sim_scale;
+
+  if (sim_DelayHook != NULL)
+    sim_DelayHook(Delay);
+  if (us >= 1)
+  {
+    ts.tv_sec = (time_t)(us / 1e6);
+    ts.tv_nsec = (long)((us - ts.tv_sec * 1e6) * 1000);
+    while (nanosleep(&ts, &ts) != 0) { };
+  }
+  sim_Advance((uint64_t)Delay * 1000);
+}
+
+__weak void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+
+}
@@ -0,0 +1,83 @@
+/*
+ * hal_sim.h
+ *
+ *  Host simulator of the I2C HAL and of SSD1306 displays
+ *  - the I2C transfers are decoded (control byte, commands, GDDRAM data)
+ *    into emulated displays (addressing modes, address window, remap,
+ *    start line, display offset, scroll)
+ *  - the DMA transfers end asynchronously: HAL_I2C_MemTxCpltCallback is
+ *    called from a signal handler of the main thread (the "interrupt"),
+ *    __disable_irq / __enable_irq / __get_PRIMASK / __set_PRIMASK block the
+ *    signal (the interrupt does not preempt itself)
+ *  - virtual time: HAL_Delay does not sleep, the time advances with the
+ *    delays and with the modelled duration of the I2C transfers
+ *  - counters of the bus traffic (transactions, bytes, interrupts)
+ */
+
+#ifndef HAL_SIM_H_
+#define HAL_SIM_H_
+
+#include "main.h"
+
+// Modelled I2C bus clock (Hz)
+#ifndef SIM_I2C_CLOCK
+#define SIM_I2C_CLOCK       400000
+#endif
+
+//
+//  Traffic of an I2C bus
+//
+typedef struct {
+  uint32_t transactions;          // I2C transactions
+  uint32_t wire_bytes;            // all bytes on the wire (with I2C address and control byte)
+  uint32_t cmd_bytes;             // command bytes (control byte 0x00)
+  uint32_t data_bytes;            // GDDRAM data bytes (control byte 0x40)
+  uint32_t irqs;                  // DMA transfer complete interrupts
+} sim_counters;
+
+//
+//  Emulated display
+//
+typedef struct {
+  I2C_HandleTypeDef *bus;
+  uint8_t  addr;                  // 7 bit I2C address
+  uint8_t  ram[8][128];           // GDDRAM
+  uint8_t  mode;                  // 0: horizontal, 1: vertical, 2: page addressing mode
+  uint8_t  col, page;             // RAM pointer
+  uint8_t  colstart, colend;      // address window (horizontal and vertical addressing mode)
+  uint8_t  pagestart, pageend;
+  uint8_t  mux;                   // multiplex ratio - 1 (rows - 1)
+  uint8_t  startline, offset;
+  uint8_t  remap, comdec, invert, allon, on, contrast;
+  uint8_t  clockdiv, precharge;
+  uint8_t  cmd, need, argc, args[8]; // command parser
+  uint8_t  scrolling;             // 0x2F ... 0x2E
+  uint8_t  scrollcmd;             // 0x26, 0x27, 0x29, 0x2A
+  uint8_t  sstart, send, sinterval, svoffset; // scroll setup
+  uint8_t  vfixed, vrows;         // vertical scroll area (0xA3)
+  uint8_t  vscroll;               // vertical scroll position
+  uint64_t scrolltime;            // virtual time of the next scroll step
+  uint32_t frames;                // completed address windows (the RAM pointer wrapped to the window start)
+  uint32_t screens;               // completed address windows of the whole screen (continuous update frames)
+  uint32_t ramwrites_scrolling;   // data bytes written while scrolling (undefined on the real display)
+} sim_panel;
+
+void sim_Init(double time_scale);  /* 0: the DMA transfers end immediately, 1: real time of the modelled bus */
+sim_panel *sim_AddPanel(I2C_HandleTypeDef *bus, uint8_t addr7);
+sim_panel *sim_GetPanel(I2C_HandleTypeDef *bus, uint8_t addr7);
+sim_counters sim_GetCounters(I2C_HandleTypeDef *bus);
+void sim_ResetCounters(void);
+uint64_t sim_Time(void);           /* virtual time (us) */
+int sim_Settle(void);              /* wait until the buses are idle or (continuous update) every display got two more whole screens (0: ok, -1: timeout) */
+uint8_t sim_RamByte(sim_panel *p, uint8_t page, uint8_t col);
+uint8_t sim_Height(sim_panel *p);  /* visible rows */
+uint8_t sim_Render(sim_panel *p, uint8_t img[64][128]); /* visible picture (0/1 pixels, remap, start line, scroll, invert), return the rows */
+int sim_WritePBM(uint8_t img[64][128], uint8_t rows, const char *path);
+int sim_ComparePBM(uint8_t img[64][128], uint8_t rows, const char *path); /* number of different pixels (-1: file error) */
+
+// Called at the beginning of HAL_Delay (main thread)
+extern void (*sim_DelayHook)(uint32_t ms);
+// Called once when the virtual time reaches t (interrupt context)
+void sim_SetAlarm(uint64_t t, void (*fn)(void));
+
+#endif /* HAL_SIM_H_ */
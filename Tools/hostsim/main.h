@@ -0,0 +1,61 @@
+/*
+ * main.h
+ *
+ *  Host (Linux) stand-in of the CubeMX generated main.h and of the
+ *  STM32 HAL functions used by the ssd1306 driver.
+ *  The functions are implemented by the simulator (hal_sim.c).
+ */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __weak  __attribute__((weak))
+
+typedef enum
+{
+  HAL_OK       = 0x00,
+  HAL_ERROR    = 0x01,
+  HAL_BUSY     = 0x02,
+  HAL_TIMEOUT  = 0x03
+} HAL_StatusTypeDef;
+
+typedef enum
+{
+  HAL_I2C_STATE_RESET   = 0x00,
+  HAL_I2C_STATE_READY   = 0x20,
+  HAL_I2C_STATE_BUSY    = 0x24,
+  HAL_I2C_STATE_BUSY_TX = 0x21
+} HAL_I2C_StateTypeDef;
+
+typedef struct
+{
+  uint32_t Id;
+} I2C_TypeDef;
+
+typedef struct
+{
+  I2C_TypeDef                      *Instance;
+  volatile HAL_I2C_StateTypeDef    State;
+} I2C_HandleTypeDef;
+
+extern I2C_HandleTypeDef hi2c1;
+extern I2C_HandleTypeDef hi2c2;
+extern I2C_HandleTypeDef hi2c3;
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress, uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_I2C_StateTypeDef HAL_I2C_GetState(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+void __disable_irq(void);
+void __enable_irq(void);
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+
+#endif /* __MAIN_H */
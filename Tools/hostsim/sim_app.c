@@ -0,0 +1,172 @@
+/*
+ * sim_app.c
+ *
+ *  Runs an App/ test program (mainApp) on the host simulator.
+ *  At the checkpoints the picture of the display is saved and/or compared
+ *  with the golden pictures, and the bus traffic since the previous
+ *  checkpoint is printed.
+ *  Checkpoints: every HAL_Delay of at least DELAY ms (the picture is ready),
+ *  or with -t every PERIOD ms of virtual time (continuous update programs).
+ *
+ *  -x LIST: checkpoints with measured values (e.g. FPS, they can differ from
+ *  run to run in DMA mode), they are not saved and not compared (e.g. -x 0,1,2)
+ *
+ *  usage: sim_app [-o OUTDIR] [-g GOLDENDIR] [-n CHECKPOINTS] [-d DELAY] [-t PERIOD] [-s TIMESCALE] [-x LIST]
+ *  exit code: 0: ok, 1: a picture differs from the golden picture
+ */
+
+#define _GNU_SOURCE
+#include "hal_sim.h"
+#include "ssd1306.h"
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+void mainApp(void);
+
+static const char *outdir = NULL;
+static const char *goldendir = NULL;
+static int checkpoints = 8;
+static uint32_t mindelay = 1000;
+static uint32_t period = 0;
+static const char *skiplist = NULL;
+
+static sim_panel *panel;
+static int checkpoint = 0;
+static int failed = 0;
+
+static uint8_t snapshot[64][128];
+static uint8_t snapshotrows;
+static sem_t snapshotsem;
+
+//
+//  Is the checkpoint in the -x list?
+//
+static int Skipped(int n)
+{
+  const char *s = skiplist;
+  while (s != NULL && *s)
+  {
+    if (atoi(s) == n)
+      return 1;
+    s = strchr(s, ',');
+    if (s != NULL)
+      s++;
+  }
+  return 0;
+}
+
+//
+//  Save / compare the picture and print the traffic since the previous checkpoint
+//
+static void Checkpoint(uint8_t img[64][128], uint8_t rows)
+{
+  char path[512];
+  int diff;
+  int skip = Skipped(checkpoint);
+  sim_counters c = sim_GetCounters(&SSD1306_I2C_PORT);
+
+  printf("%03d t=%llu ms: tx=%u wire=%u cmd=%u data=%u irq=%u frames=%u",
+         checkpoint, (unsigned long long)(sim_Time() / 1000), c.transactions, c.wire_bytes,
+         c.cmd_bytes, c.data_bytes, c.irqs, panel->frames);
+  sim_ResetCounters();
+  if (skip)
+    printf(" measured: skipped");
+  if (outdir != NULL && !skip)
+  {
+    snprintf(path, sizeof(path), "%s/%03d.pbm", outdir, checkpoint);
+    sim_WritePBM(img, rows, path);
+  }
+  if (goldendir != NULL && !skip)
+  {
+    snprintf(path, sizeof(path), "%s/%03d.pbm", goldendir, checkpoint);
+    diff = sim_ComparePBM(img, rows, path);
+    if (diff)
+    {
+      failed = 1;
+      if (diff < 0)
+        printf(" golden: missing");
+      else
+        printf(" golden: %d pixels differ", diff);
+    }
+    else
+      printf(" golden: ok");
+  }
+  printf("\n");
+  fflush(stdout);
+
+  if (++checkpoint >= checkpoints)
+    exit(failed);
+}
+
+static void DelayCheckpoint(uint32_t ms)
+{
+  uint8_t img[64][128];
+  uint8_t rows;
+  if (ms < mindelay)
+    return;
+  sim_Settle();
+  rows = sim_Render(panel, img);
+  Checkpoint(img, rows);
+}
+
+//
+//  Timed checkpoint (interrupt context): only the picture is taken here
+//
+static void TimedCheckpoint(void)
+{
+  snapshotrows = sim_Render(panel, snapshot);
+  sem_post(&snapshotsem);
+  sim_SetAlarm(sim_Time() + period * 1000ULL, TimedCheckpoint);
+}
+
+static void *CheckpointThread(void *arg)
+{
+  for (;;)
+  {
+    while (sem_wait(&snapshotsem) != 0) { };
+    Checkpoint(snapshot, snapshotrows);
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv)
+{
+  int opt;
+  double scale = 0;
+  pthread_t t;
+
+  while ((opt = getopt(argc, argv, "o:g:n:d:t:s:x:")) != -1)
+  {
+    switch (opt)
+    {
+      case 'o': outdir = optarg; break;
+      case 'g': goldendir = optarg; break;
+      case 'n': checkpoints = atoi(optarg); break;
+      case 'd': mindelay = atoi(optarg); break;
+      case 't': period = atoi(optarg); break;
+      case 's': scale = atof(optarg); break;
+      case 'x': skiplist = optarg; break;
+      default:
+        fprintf(stderr, "usage: %s [-o OUTDIR] [-g GOLDENDIR] [-n CHECKPOINTS] [-d DELAY] [-t PERIOD] [-s TIMESCALE] [-x LIST]\n", argv[0]);
+        return 2;
+    }
+  }
+
+  sim_Init(scale);
+  panel = sim_AddPanel(&SSD1306_I2C_PORT, SSD1306_ADDRESS);
+  if (period)
+  {
+    sem_init(&snapshotsem, 0, 0);
+    pthread_create(&t, NULL, CheckpointThread, NULL);
+    sim_SetAlarm(period * 1000ULL, TimedCheckpoint);
+  }
+  else
+    sim_DelayHook = DelayCheckpoint;
+
+  mainApp();
+  return failed;
+}
@@ -0,0 +1,131 @@
+/*
+ * test_dirty.c
+ *
+ *  Host test of the dirty tracking: the bytes on the wire of typical updates
+ *  (full frame, one digit, no change, one pixel in every corner) and the
+ *  interrupts of a full frame are compared with the expected values (of the
+ *  selected geometry, SSD1306_128X64 or SSD1306_128X32).
+ *  In continuous update mode the interrupts per frame are checked without
+ *  and with raster interrupts.
+ *
+ *  gcc -O2 -ITools/hostsim -IDrivers Tools/hostsim/test_dirty.c Tools/hostsim/hal_sim.c Drivers/ssd1306.c Drivers/fonts.c -o test_dirty -lpthread
+ *  ./test_dirty
+ *  exit code: 0: ok, 1: a counter differs from the expected value
+ *  (see also Tools/hostsim/Makefile)
+ */
+
+#include "hal_sim.h"
+#include "ssd1306.h"
+#include <stdio.h>
+
+#if SSD1306_USE_DMA == 1
+#define IRQS_FRAME  2             // address window + data
+#else
+#define IRQS_FRAME  0
+#endif
+#define IRQS_RASTER (1 + SSD1306_HEIGHT / 8) // address window + every page (9 on 128x64)
+#define WINDOW_WIRE 10            // wire bytes of a window besides its data: address, control, 6 commands, address, control
+
+static int failed = 0;
+
+static void Expect(const char *name, const char *counter, uint32_t value, uint32_t expected)
+{
+  if (value != expected)
+  {
+    printf("%-14s %-10s %5u (expected %u)\n", name, counter, value, expected);
+    failed = 1;
+  }
+}
+
+#if SSD1306_CONTUPDATE == 0
+//
+//  Update the screen and check the traffic of the update
+//
+static void Update(const char *name, uint32_t wire, uint32_t data, uint32_t irqs)
+{
+  sim_counters c;
+  sim_ResetCounters();
+  ssd1306_UpdateScreen();
+  sim_Settle();
+  c = sim_GetCounters(&SSD1306_I2C_PORT);
+  printf("%-14s wire=%u data=%u irq=%u\n", name, c.wire_bytes, c.data_bytes, c.irqs);
+  Expect(name, "wire_bytes", c.wire_bytes, wire);
+  Expect(name, "data_bytes", c.data_bytes, data);
+  Expect(name, "irqs", c.irqs, irqs);
+}
+
+int main(void)
+{
+  sim_Init(0);
+  sim_AddPanel(&SSD1306_I2C_PORT, SSD1306_ADDRESS);
+  ssd1306_Init();
+  sim_Settle();
+
+  ssd1306_SetColor(White);
+  ssd1306_Fill();
+  Update("full frame", WINDOW_WIRE + SSD1306_BUFFER_SIZE, SSD1306_BUFFER_SIZE, IRQS_FRAME);
+
+  ssd1306_SetColor(Black);
+  ssd1306_SetCursor(60, 20);
+  ssd1306_WriteString("5", Font_7x10);
+#if SSD1306_SHADOW == 1
+  Update("one digit", 2 * WINDOW_WIRE + 10, 10, 2 * IRQS_FRAME);   /* pages 2 and 3, only the 5 changed columns */
+#else
+  Update("one digit", 2 * WINDOW_WIRE + 14, 14, 2 * IRQS_FRAME);   /* pages 2 and 3: two windows of 7 columns */
+#endif
+
+  Update("no change", 0, 0, 0);
+
+  ssd1306_DrawPixel(0, 0);
+  Update("top left", WINDOW_WIRE + 1, 1, IRQS_FRAME);
+  ssd1306_DrawPixel(SSD1306_WIDTH - 1, 0);
+  Update("top right", WINDOW_WIRE + 1, 1, IRQS_FRAME);
+  ssd1306_DrawPixel(0, SSD1306_HEIGHT - 1);
+  Update("bottom left", WINDOW_WIRE + 1, 1, IRQS_FRAME);
+  ssd1306_DrawPixel(SSD1306_WIDTH - 1, SSD1306_HEIGHT - 1);
+  Update("bottom right", WINDOW_WIRE + 1, 1, IRQS_FRAME);
+
+  printf(failed ? "FAILED\n" : "ok\n");
+  return failed;
+}
+#else
+//
+//  Run the continuous update for FRAMES frames and check the interrupts per frame
+//  (the update is stopped before, so only whole frames are counted)
+//
+#define FRAMES      10
+
+static void Frames(const char *name, uint8_t raster, uint32_t irqs)
+{
+  sim_panel *p = sim_GetPanel(&SSD1306_I2C_PORT, SSD1306_ADDRESS);
+  sim_counters c;
+  uint32_t frames;
+
+  ssd1306_ContUpdateDisable();
+  ssd1306_SetRasterInt(raster);
+  sim_ResetCounters();
+  frames = p->frames;
+  ssd1306_ContUpdateEnable();
+  while (p->frames - frames < FRAMES)
+    HAL_Delay(1);
+  ssd1306_ContUpdateDisable();
+  c = sim_GetCounters(&SSD1306_I2C_PORT);
+  frames = p->frames - frames;
+  printf("%-14s frames=%u irq=%u\n", name, frames, c.irqs);
+  Expect(name, "irqs", c.irqs, irqs * frames);
+}
+
+int main(void)
+{
+  sim_Init(0);
+  sim_AddPanel(&SSD1306_I2C_PORT, SSD1306_ADDRESS);
+  ssd1306_Init();
+  sim_Settle();
+
+  Frames("frames", 0, IRQS_FRAME);
+  Frames("raster ints", 255, IRQS_RASTER);
+
+  printf(failed ? "FAILED\n" : "ok\n");
+  return failed;
+}
+#endif
@@ -0,0 +1,241 @@
+/*
+ * imgpack.c
+ *
+ *  Compresses a 1 bit image for ssd1306_DrawCompressedBitmap. The image is
+ *  converted to the page format (one byte per column of 8 rows, bit 0: top
+ *  row, the rows below the height are 0) and coded with literals, runs of a
+ *  byte, runs of zeros and copies from the last 256 bytes (see the decoder in
+ *  ssd1306.c). The tokens are chosen with an optimal parse (shortest output).
+ *  The output is C source (width, height, tokens), checked by decoding it.
+ *
+ *  input: PBM (P1 or P4, 1: black pixel -> lit pixel on the display), or with
+ *  -c WIDTH HEIGHT a C source of a page format array (e.g. stm32fan.h, the
+ *  hex numbers of the first array are read)
+ *
+ *  gcc -O2 Tools/image/imgpack.c -o imgpack
+ *  ./imgpack logo image.pbm > logo.c
+ *  ./imgpack -c 128 64 stm32fan_packed stm32fan.h > image.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAXSIZE  (255 * 32)       // page format bytes of a 255 x 255 image
+
+static uint8_t img[MAXSIZE];      // page format bytes
+static int width, height, size;
+
+static uint8_t out[MAXSIZE * 2];
+static int outsize;
+
+//
+//  Read a PBM file (P1 or P4) into the page format
+//
+static int ReadPBM(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  int c, x, y, v = 0, bits = 0;
+  char magic[3] = {0};
+
+  if (f == NULL || fscanf(f, "%2s", magic) != 1 || (strcmp(magic, "P1") && strcmp(magic, "P4")))
+    return -1;
+  // the comments between the numbers
+  while ((c = fgetc(f)) != EOF && (c == '#' || c == ' ' || c == '\n' || c == '\r' || c == '\t'))
+  {
+    if (c == '#')
+      while ((c = fgetc(f)) != EOF && c != '\n') { }
+  }
+  ungetc(c, f);
+  if (fscanf(f, "%d %d", &width, &height) != 2 || width < 1 || width > 255 || height < 1 || height > 255)
+    return -1;
+  fgetc(f);
+  size = width * ((height + 7) / 8);
+  memset(img, 0, size);
+  for (y = 0; y < height; y++)
+  {
+    bits = 0;
+    for (x = 0; x < width; x++)
+    {
+      if (magic[1] == '4')
+      {
+        if (bits == 0)
+        {
+          v = fgetc(f);
+          bits = 8;
+        }
+        c = (v >> --bits) & 1;
+      }
+      else
+      {
+        while ((c = fgetc(f)) != EOF && c != '0' && c != '1') { }
+        c = (c == '1');
+      }
+      if (c)
+        img[(y / 8) * width + x] |= 1 << (y & 7);
+    }
+  }
+  fclose(f);
+  return 0;
+}
+
+//
+//  Read the hex numbers of the first C array of a source file
+//
+static int ReadC(const char *path)
+{
+  FILE *f = fopen(path, "r");
+  int c;
+  unsigned v;
+
+  size = width * ((height + 7) / 8);
+  if (f == NULL || width < 1 || width > 255 || height < 1 || height > 255)
+    return -1;
+  while ((c = fgetc(f)) != EOF && c != '{') { }
+  for (int i = 0; i < size; i++)
+  {
+    while ((c = fgetc(f)) != EOF && c != '0') { }
+    if (c == EOF || fscanf(f, "x%x", &v) != 1)
+      return -1;
+    img[i] = v;
+  }
+  fclose(f);
+  return 0;
+}
+
+//
+//  Optimal parse: cost[i] = bytes of the shortest coding of img[i..]
+//
+static void Pack(void)
+{
+  static int cost[MAXSIZE + 1], len[MAXSIZE + 1], kind[MAXSIZE + 1], dist[MAXSIZE + 1];
+  int i, n, d, m, c;
+
+  cost[size] = 0;
+  for (i = size - 1; i >= 0; i--)
+  {
+    cost[i] = 1 << 30;
+    for (n = 1; n <= 64 && i + n <= size; n++)
+    { /* literals */
+      c = 1 + n + cost[i + n];
+      if (c < cost[i]) { cost[i] = c; kind[i] = 0; len[i] = n; }
+    }
+    for (n = 1; n < 65 && i + n < size && img[i + n] == img[i]; n++) { }
+    for (m = 1; m <= n; m++)
+    { /* runs (zeros: 1 byte) */
+      if (img[i] == 0 && m <= 64)
+      {
+        c = 1 + cost[i + m];
+        if (c < cost[i]) { cost[i] = c; kind[i] = 3; len[i] = m; }
+      }
+      else if (m >= 2)
+      {
+        c = 2 + cost[i + m];
+        if (c < cost[i]) { cost[i] = c; kind[i] = 1; len[i] = m; }
+      }
+    }
+    for (d = 1; d <= 256 && d <= i; d++)
+    { /* copies */
+      for (n = 0; n < 66 && i + n < size && img[i + n] == img[i + n - d]; n++) { }
+      for (m = 3; m <= n; m++)
+      {
+        c = 2 + cost[i + m];
+        if (c < cost[i]) { cost[i] = c; kind[i] = 2; len[i] = m; dist[i] = d; }
+      }
+    }
+  }
+
+  outsize = 0;
+  out[outsize++] = width;
+  out[outsize++] = height;
+  for (i = 0; i < size; i += len[i])
+  {
+    switch (kind[i])
+    {
+      case 0:
+        out[outsize++] = len[i] - 1;
+        memcpy(&out[outsize], &img[i], len[i]);
+        outsize += len[i];
+        break;
+      case 1:
+        out[outsize++] = 0x40 | (len[i] - 2);
+        out[outsize++] = img[i];
+        break;
+      case 2:
+        out[outsize++] = 0x80 | (len[i] - 3);
+        out[outsize++] = dist[i] - 1;
+        break;
+      case 3:
+        out[outsize++] = 0xC0 | (len[i] - 1);
+        break;
+    }
+  }
+}
+
+//
+//  Decode the output (the same way as the driver) and compare
+//
+static int Check(void)
+{
+  static uint8_t dec[MAXSIZE];
+  const uint8_t *p = out + 2;
+  int i = 0, n, t, d;
+
+  while (i < size)
+  {
+    t = *p++;
+    n = (t & 0x3F) + 1;
+    switch (t >> 6)
+    {
+      case 0: while (n--) dec[i++] = *p++; break;
+      case 1: n++; t = *p++; while (n--) dec[i++] = t; break;
+      case 2: n += 2; d = *p++ + 1; while (n--) { dec[i] = dec[i - d]; i++; } break;
+      case 3: while (n--) dec[i++] = 0; break;
+    }
+  }
+  return (i == size && p == out + outsize && memcmp(dec, img, size) == 0) ? 0 : -1;
+}
+
+int main(int argc, char **argv)
+{
+  const char *name;
+  int i, r;
+
+  if (argc == 6 && strcmp(argv[1], "-c") == 0)
+  {
+    width = atoi(argv[2]);
+    height = atoi(argv[3]);
+    name = argv[4];
+    r = ReadC(argv[5]);
+  }
+  else if (argc == 3)
+  {
+    name = argv[1];
+    r = ReadPBM(argv[2]);
+  }
+  else
+  {
+    fprintf(stderr, "usage: %s NAME IMAGE.pbm\n       %s -c WIDTH HEIGHT NAME ARRAY.h\n", argv[0], argv[0]);
+    return 2;
+  }
+  if (r)
+  {
+    fprintf(stderr, "%s: cannot read the image\n", argv[0]);
+    return 1;
+  }
+
+  Pack();
+  if (Check())
+  {
+    fprintf(stderr, "%s: decoding error\n", argv[0]);
+    return 1;
+  }
+
+  printf("// '%s', %dx%dpx, %d -> %d bytes (ssd1306_DrawCompressedBitmap)\n", name, width, height, size, outsize);
+  printf("const unsigned char %s [] = {", name);
+  for (i = 0; i < outsize; i++)
+    printf("%s0x%02x%s", (i % 16) ? " " : "\n  ", out[i], (i + 1 < outsize) ? "," : "");
+  printf("\n};\n");
+  return 0;
+}